@@ -130,7 +130,27 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fUseDense(kFALSE),
+  fDenseFloatM(kFALSE),
+  fDenseFloatT(kFALSE),
+  fDenseFloatInv(kFALSE),
+  fDenseCellsM(0x0),
+  fDenseCellsT(0x0),
+  fNDenseM(0),
+  fNDenseT(0),
+  fNDenseCond(0),
+  fDenseCondM(0x0),
+  fDenseCondT(0x0),
+  fDenseCond(0x0),
+  fDenseInvResponse(0x0),
+  fDensePriorTimesEff(0x0),
+  fDenseEfficiency(0x0),
+  fDenseMeasured(0x0),
+  fDenseEstMeasured(0x0),
+  fDenseUnfolded(0x0),
+  fDenseIsFilled(0x0),
+  fDenseFilled(0x0)
 {
   //
   // default constructor
@@ -174,7 +194,27 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fUseDense(kFALSE),
+  fDenseFloatM(kFALSE),
+  fDenseFloatT(kFALSE),
+  fDenseFloatInv(kFALSE),
+  fDenseCellsM(0x0),
+  fDenseCellsT(0x0),
+  fNDenseM(0),
+  fNDenseT(0),
+  fNDenseCond(0),
+  fDenseCondM(0x0),
+  fDenseCondT(0x0),
+  fDenseCond(0x0),
+  fDenseInvResponse(0x0),
+  fDensePriorTimesEff(0x0),
+  fDenseEfficiency(0x0),
+  fDenseMeasured(0x0),
+  fDenseEstMeasured(0x0),
+  fDenseUnfolded(0x0),
+  fDenseIsFilled(0x0),
+  fDenseFilled(0x0)
 {
   //
   // named constructor
@@ -239,7 +279,7 @@ AliCFUnfolding::~AliCFUnfolding() {
   if (fRandom3)            delete fRandom3;
   if (fDeltaUnfoldedP)     delete fDeltaUnfoldedP;
   if (fDeltaUnfoldedN)     delete fDeltaUnfoldedN;
- 
+  ClearDense();
 }
 
 //______________________________________________________________
@@ -274,6 +314,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
+  // dense arrays for the bayes iterations, if cheaper than the sparse bin lookups
+  fUseDense = InitDense();
 
 }
 
@@ -292,6 +334,11 @@ void AliCFUnfolding::CreateEstMeasured() {
   //
 
 
+  if (fUseDense) {
+    CreateEstMeasuredDense();
+    return;
+  }
+
   // clean the measured estimate spectrum
   fMeasuredEstimate->Reset();
 
@@ -324,6 +371,11 @@ void AliCFUnfolding::CreateInvResponse() {
   // --> INV(i,j) = COND(i,j) * T(j) * E(j)   / SUM_k { COND(i,k) * T(k) }
   //
 
+  if (fUseDense) {
+    CreateInvResponseDense();
+    return;
+  }
+
   THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
   priorTimesEff->Multiply(fEfficiency);
 
@@ -422,6 +474,11 @@ void AliCFUnfolding::CreateUnfolded() {
   // if in the process of error calculation, the random unfolded spectrum is created
   // otherwise the normal unfolded spectrum is created
 
+  if (fUseDense) {
+    CreateUnfoldedDense();
+    return;
+  }
+
   fUnfolded->Reset();
   
   for (Long_t iBin=0; iBin<fInverseResponse->GetNbins(); iBin++) {
@@ -443,6 +500,248 @@ void AliCFUnfolding::CreateUnfolded() {
 
 //______________________________________________________________
 
+Bool_t AliCFUnfolding::InitDense() {
+  //
+  // Sets up the dense representation of the spectra used in the bayes iterations.
+  // The sparse version of the iterations does several hash lookups per bin of the
+  // conditional matrix; with dense arrays these become array accesses, at the price
+  // of looping over all the cells of the measured and true spaces in each step.
+  // The dense representation is only used if this is cheaper, i.e. if the spaces
+  // are not too large compared to the number of filled bins of the response matrix.
+  //
+  // The dense steps reproduce the sparse ones exactly : same order of the sums,
+  // rounding to the storage precision of the THnSparse, and bins of the output
+  // spectra created in the same order.
+  //
+
+  const Long_t kMaxDenseCells  = 4000000; // memory limit per space
+  const Long_t kDenseCostRatio = 8;       // cost of a sparse bin lookup wrt a dense cell
+
+  // single or double precision storage only
+  const THnSparse* stored[4] = {fMeasured,fPrior,fEfficiency,fInverseResponse};
+  Bool_t isFloat[4];
+  for (Int_t i=0; i<4; i++) {
+    if      (dynamic_cast<const THnSparseD*>(stored[i])) isFloat[i] = kFALSE;
+    else if (dynamic_cast<const THnSparseF*>(stored[i])) isFloat[i] = kTRUE;
+    else return kFALSE;
+  }
+  fDenseFloatM   = isFloat[0];
+  fDenseFloatT   = isFloat[1];
+  fDenseFloatInv = isFloat[3];
+
+  // the inverse response must have the same bins as the conditional matrix (both are clones of the response)
+  if (fInverseResponse->GetNbins() != fConditional->GetNbins()) return kFALSE;
+
+  Long_t nCellsM = 1, nCellsT = 1;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    if (fMeasured->GetAxis(iVar)->GetNbins() != fResponse->GetAxis(iVar)->GetNbins() ||
+	fPrior->GetAxis(iVar)->GetNbins() != fResponse->GetAxis(iVar+fNVariables)->GetNbins()) return kFALSE;
+    nCellsM *= fMeasured->GetAxis(iVar)->GetNbins()+2;
+    nCellsT *= fPrior   ->GetAxis(iVar)->GetNbins()+2;
+    if (nCellsM > kMaxDenseCells || nCellsT > kMaxDenseCells) return kFALSE;
+  }
+  if (nCellsM + nCellsT > kDenseCostRatio * fConditional->GetNbins()) return kFALSE;
+
+  fNDenseM    = nCellsM;
+  fNDenseT    = nCellsT;
+  fNDenseCond = fConditional->GetNbins();
+  fDenseCellsM = new Int_t[fNVariables];
+  fDenseCellsT = new Int_t[fNVariables];
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    fDenseCellsM[iVar] = fMeasured->GetAxis(iVar)->GetNbins()+2;
+    fDenseCellsT[iVar] = fPrior   ->GetAxis(iVar)->GetNbins()+2;
+  }
+
+  // the conditional matrix is created once, keep its content and cells
+  fDenseCondM       = new Long_t  [fNDenseCond];
+  fDenseCondT       = new Long_t  [fNDenseCond];
+  fDenseCond        = new Double_t[fNDenseCond];
+  fDenseInvResponse = new Double_t[fNDenseCond];
+  for (Long_t iBin=0; iBin<fNDenseCond; iBin++) {
+    fDenseCond[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    fDenseCondM[iBin] = GetDenseCell(fCoordinatesN_M,fDenseCellsM);
+    fDenseCondT[iBin] = GetDenseCell(fCoordinatesN_T,fDenseCellsT);
+    fDenseInvResponse[iBin] = fInverseResponse->GetBinContent(iBin);
+  }
+
+  Long_t nCellsMax = TMath::Max(fNDenseM,fNDenseT);
+  fDensePriorTimesEff = new Double_t[fNDenseT];
+  fDenseEfficiency    = new Double_t[fNDenseT];
+  fDenseUnfolded      = new Double_t[fNDenseT];
+  fDenseMeasured      = new Double_t[fNDenseM];
+  fDenseEstMeasured   = new Double_t[fNDenseM];
+  fDenseIsFilled      = new Char_t  [nCellsMax];
+  fDenseFilled        = new Long_t  [nCellsMax];
+
+  AliInfo(Form("Using dense representation : %ld measured cells, %ld true cells, %ld response bins",fNDenseM,fNDenseT,fNDenseCond));
+  return kTRUE;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::ClearDense() {
+  //
+  // frees the dense arrays
+  //
+  delete [] fDenseCellsM;        fDenseCellsM = 0x0;
+  delete [] fDenseCellsT;        fDenseCellsT = 0x0;
+  delete [] fDenseCondM;         fDenseCondM = 0x0;
+  delete [] fDenseCondT;         fDenseCondT = 0x0;
+  delete [] fDenseCond;          fDenseCond = 0x0;
+  delete [] fDenseInvResponse;   fDenseInvResponse = 0x0;
+  delete [] fDensePriorTimesEff; fDensePriorTimesEff = 0x0;
+  delete [] fDenseEfficiency;    fDenseEfficiency = 0x0;
+  delete [] fDenseMeasured;      fDenseMeasured = 0x0;
+  delete [] fDenseEstMeasured;   fDenseEstMeasured = 0x0;
+  delete [] fDenseUnfolded;      fDenseUnfolded = 0x0;
+  delete [] fDenseIsFilled;      fDenseIsFilled = 0x0;
+  delete [] fDenseFilled;        fDenseFilled = 0x0;
+  fUseDense = kFALSE;
+}
+
+//______________________________________________________________
+
+Long_t AliCFUnfolding::GetDenseCell(const Int_t* coord, const Int_t* cells) const {
+  //
+  // index of the cell with bin coordinates coord (first variable running fastest)
+  //
+  Long_t cell = 0;
+  for (Int_t iVar=fNVariables-1; iVar>=0; iVar--) cell = cell*cells[iVar] + coord[iVar];
+  return cell;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetDenseCoordinates(Long_t cell, const Int_t* cells, Int_t* coord) const {
+  //
+  // bin coordinates of a cell, inverse of GetDenseCell
+  //
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    coord[iVar] = cell % cells[iVar];
+    cell /= cells[iVar];
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillDense(const THnSparse* h, Double_t* dense, const Int_t* cells, Long_t nCells) {
+  //
+  // copies the content of h into the dense array
+  //
+  for (Long_t iCell=0; iCell<nCells; iCell++) dense[iCell] = 0.;
+  Int_t* coord = new Int_t[fNVariables];
+  for (Long_t iBin=0; iBin<h->GetNbins(); iBin++) {
+    Double_t value = h->GetBinContent(iBin,coord);
+    dense[GetDenseCell(coord,cells)] = value;
+  }
+  delete [] coord;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateEstMeasuredDense() {
+  //
+  // dense version of CreateEstMeasured
+  //
+
+  // prior x efficiency, as THnSparse::Multiply : stored with the prior precision
+  FillDense(fPrior     ,fDensePriorTimesEff,fDenseCellsT,fNDenseT);
+  FillDense(fEfficiency,fDenseEfficiency   ,fDenseCellsT,fNDenseT);
+  for (Long_t iCell=0; iCell<fNDenseT; iCell++) {
+    Double_t value = fDensePriorTimesEff[iCell] * fDenseEfficiency[iCell];
+    fDensePriorTimesEff[iCell] = fDenseFloatT ? (Double_t)(Float_t)value : value;
+  }
+
+  Long_t nFilled = 0;
+  for (Long_t iCell=0; iCell<fNDenseM; iCell++) {
+    fDenseEstMeasured[iCell] = 0.;
+    fDenseIsFilled[iCell] = 0;
+  }
+  for (Long_t iBin=0; iBin<fNDenseCond; iBin++) {
+    Double_t fill = fDenseCond[iBin] * fDensePriorTimesEff[fDenseCondT[iBin]];
+    if (fill>0.) {
+      Long_t cell = fDenseCondM[iBin];
+      Double_t value = fDenseEstMeasured[cell] + fill;
+      fDenseEstMeasured[cell] = fDenseFloatM ? (Double_t)(Float_t)value : value;
+      if (!fDenseIsFilled[cell]) {
+	fDenseIsFilled[cell] = 1;
+	fDenseFilled[nFilled++] = cell;
+      }
+    }
+  }
+
+  // copy back, creating the bins in the same order as the sparse version
+  fMeasuredEstimate->Reset();
+  for (Long_t iFilled=0; iFilled<nFilled; iFilled++) {
+    Long_t cell = fDenseFilled[iFilled];
+    GetDenseCoordinates(cell,fDenseCellsM,fCoordinatesN_M);
+    fMeasuredEstimate->SetBinContent(fCoordinatesN_M,fDenseEstMeasured[cell]);
+    fMeasuredEstimate->SetBinError  (fCoordinatesN_M,0.);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateInvResponseDense() {
+  //
+  // dense version of CreateInvResponse
+  // uses prior x efficiency and the measured estimate from CreateEstMeasuredDense
+  //
+
+  for (Long_t iBin=0; iBin<fNDenseCond; iBin++) {
+    Double_t estMeasuredValue = fDenseEstMeasured[fDenseCondM[iBin]];
+    Double_t fill = (estMeasuredValue>0. ? fDenseCond[iBin] * fDensePriorTimesEff[fDenseCondT[iBin]] / estMeasuredValue : 0. ) ;
+    if (fill>0. || fDenseInvResponse[iBin]>0.) {
+      fDenseInvResponse[iBin] = fDenseFloatInv ? (Double_t)(Float_t)fill : fill;
+      fInverseResponse->SetBinContent(iBin,fill);
+      fInverseResponse->SetBinError  (iBin,0.);
+    }
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateUnfoldedDense() {
+  //
+  // dense version of CreateUnfolded
+  //
+
+  FillDense(fEfficiency,fDenseEfficiency,fDenseCellsT,fNDenseT);
+  FillDense(fMeasured  ,fDenseMeasured  ,fDenseCellsM,fNDenseM);
+
+  Long_t nFilled = 0;
+  for (Long_t iCell=0; iCell<fNDenseT; iCell++) {
+    fDenseUnfolded[iCell] = 0.;
+    fDenseIsFilled[iCell] = 0;
+  }
+  for (Long_t iBin=0; iBin<fNDenseCond; iBin++) {
+    Long_t cell = fDenseCondT[iBin];
+    Double_t effValue = fDenseEfficiency[cell];
+    Double_t fill = (effValue>0. ? fDenseInvResponse[iBin] * fDenseMeasured[fDenseCondM[iBin]] / effValue : 0.) ;
+    if (fill>0.) {
+      Double_t value = fDenseUnfolded[cell] + fill;
+      fDenseUnfolded[cell] = fDenseFloatT ? (Double_t)(Float_t)value : value;
+      if (!fDenseIsFilled[cell]) {
+	fDenseIsFilled[cell] = 1;
+	fDenseFilled[nFilled++] = cell;
+      }
+    }
+  }
+
+  // copy back, creating the bins in the same order as the sparse version
+  // (the order matters for the sums over the bins of the next prior)
+  fUnfolded->Reset();
+  for (Long_t iFilled=0; iFilled<nFilled; iFilled++) {
+    Long_t cell = fDenseFilled[iFilled];
+    GetDenseCoordinates(cell,fDenseCellsT,fCoordinatesN_T);
+    fUnfolded->SetBinError  (fCoordinatesN_T,0.);
+    fUnfolded->SetBinContent(fCoordinatesN_T,fDenseUnfolded[cell]);
+  }
+}
+
+//______________________________________________________________
+
 void AliCFUnfolding::CalculateCorrelatedErrors() {
 
   // Step 1: Create randomized distribution (fRandomXXXX) of each bin of 
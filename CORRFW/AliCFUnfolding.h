@@ -112,6 +112,28 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* dense representation used in the bayes iterations */
+  Bool_t         fUseDense;          //! Dense arrays used in the bayes iterations (decided in Init)
+  Bool_t         fDenseFloatM;       //! Measured spectrum stored in single precision
+  Bool_t         fDenseFloatT;       //! Prior/unfolded spectra stored in single precision
+  Bool_t         fDenseFloatInv;     //! Inverse response stored in single precision
+  Int_t         *fDenseCellsM;       //! Number of cells (incl. under/overflow) per variable in measured space
+  Int_t         *fDenseCellsT;       //! Number of cells (incl. under/overflow) per variable in true space
+  Long_t         fNDenseM;           //! Number of cells in measured space
+  Long_t         fNDenseT;           //! Number of cells in true space
+  Long_t         fNDenseCond;        //! Number of bins of the conditional matrix
+  Long_t        *fDenseCondM;        //! Measured cell of each conditional bin
+  Long_t        *fDenseCondT;        //! True cell of each conditional bin
+  Double_t      *fDenseCond;         //! Content of each conditional bin
+  Double_t      *fDenseInvResponse;  //! Content of each inverse response bin (same bins as fConditional)
+  Double_t      *fDensePriorTimesEff;//! Prior x efficiency in true space
+  Double_t      *fDenseEfficiency;   //! Efficiency in true space
+  Double_t      *fDenseMeasured;     //! Measured spectrum in measured space
+  Double_t      *fDenseEstMeasured;  //! Measured estimate in measured space
+  Double_t      *fDenseUnfolded;     //! Unfolded spectrum in true space
+  Char_t        *fDenseIsFilled;     //! Cell already filled in the current step
+  Long_t        *fDenseFilled;       //! Cells filled in the current step, in order of first filling
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -132,7 +154,17 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* dense representation */
+  Bool_t   InitDense();                  // decides on and sets up the dense representation
+  void     ClearDense();                 // frees the dense arrays
+  Long_t   GetDenseCell(const Int_t* coord, const Int_t* cells) const; // cell index of bin coordinates
+  void     GetDenseCoordinates(Long_t cell, const Int_t* cells, Int_t* coord) const; // bin coordinates of a cell index
+  void     FillDense(const THnSparse* h, Double_t* dense, const Int_t* cells, Long_t nCells); // copies h into dense
+  void     CreateEstMeasuredDense();     // same as CreateEstMeasured on the dense arrays
+  void     CreateInvResponseDense();     // same as CreateInvResponse on the dense arrays
+  void     CreateUnfoldedDense();        // same as CreateUnfolded on the dense arrays
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
@@ -46,11 +46,13 @@ ClassImp(AliAnaCaloTrackCorrMaker) ;
 //__________________________________________________
 AliAnaCaloTrackCorrMaker::AliAnaCaloTrackCorrMaker() :
 TObject(),
-fReader(0),                   fCaloUtils(0),
+fReader(0),                   fReaderOwner(kTRUE),
+fCaloUtils(0),
 fOutputContainer(new TList ), fAnalysisContainer(new TList ),
 fProcessEvent(1),
 fMakeHisto(kFALSE),           fMakeAOD(kFALSE),
 fAnaDebug(0),                 fCuts(new TList),
+fAODBranchList(0),
 fScaleFactor(-1),
 fFillDataControlHisto(1),     fSumw2(0),
 fCheckPtHard(0),
@@ -98,11 +100,13 @@ fhClusterTriggerBCExoticEventBC(0),     fhClusterTriggerBCExoticEventBCUnMatch(0
 AliAnaCaloTrackCorrMaker::AliAnaCaloTrackCorrMaker(const AliAnaCaloTrackCorrMaker & maker) :
 TObject(),
 fReader(),   //(new AliCaloTrackReader(*maker.fReader)),
+fReaderOwner(maker.fReaderOwner),
 fCaloUtils(),//(new AliCalorimeterUtils(*maker.fCaloUtils)),
 fOutputContainer(new TList()), fAnalysisContainer(new TList()),
 fProcessEvent(maker.fProcessEvent),
 fMakeHisto(maker.fMakeHisto),  fMakeAOD(maker.fMakeAOD),
 fAnaDebug(maker.fAnaDebug),    fCuts(new TList()),
+fAODBranchList(0),
 fScaleFactor(maker.fScaleFactor),
 fFillDataControlHisto(maker.fFillDataControlHisto),
 fSumw2(maker.fSumw2),
@@ -181,7 +185,7 @@ AliAnaCaloTrackCorrMaker::~AliAnaCaloTrackCorrMaker()
     delete fAnalysisContainer ;
   }
   
-  if (fReader)    delete fReader ;
+  if (fReader && fReaderOwner) delete fReader ;
   if (fCaloUtils) delete fCaloUtils ;
   
   if(fCuts)
@@ -189,6 +193,8 @@ AliAnaCaloTrackCorrMaker::~AliAnaCaloTrackCorrMaker()
 	  fCuts->Delete();
 	  delete fCuts;
   }
+  
+  delete fAODBranchList; // not owner of the branches
 }
 
 //__________________________________________________________________
@@ -210,17 +216,36 @@ void AliAnaCaloTrackCorrMaker::AddAnalysis(TObject* ana, Int_t n)
 /// \return list with any new output AOD branches from analysis.
 /// The list is filled in the maker, and new branch passed to the 
 /// main analysis task AliAnalysisTaskCaloTrackCorrelation.
+/// With a reader shared with other makers, the branches are also added to
+/// the reader list but only the ones of this maker are returned.
 //_________________________________________________________
 TList * AliAnaCaloTrackCorrMaker::FillAndGetAODBranchList()
 {
   TList *aodBranchList = fReader->GetAODBranchList() ;
   
+  if ( !fReaderOwner && !fAODBranchList )
+  {
+    fAODBranchList = new TList();
+    fAODBranchList->SetOwner(kFALSE);
+  }
+  
   for(Int_t iana = 0; iana <  fAnalysisContainer->GetEntries(); iana++)
   {
     AliAnaCaloTrackCorrBaseClass * ana =  ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
-    if(ana->NewOutputAOD()) aodBranchList->Add(ana->GetCreateOutputAODBranch());
+    if(ana->NewOutputAOD())
+    {
+      TClonesArray * branch = ana->GetCreateOutputAODBranch();
+      aodBranchList->Add(branch);
+      if ( fAODBranchList ) 
+      {
+        fAODBranchList->Add(branch);
+        fReader->AddSharedAODBranch(branch);
+      }
+    }
   }
   
+  if ( fAODBranchList ) return fAODBranchList ;
+  
   return aodBranchList ;
 }
 
@@ -863,7 +888,8 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   
   // Histograms defined and filled in this class, just get the pointers
   // and add them to the list.
-  if(GetReader()->GetWeightUtils()->IsMCCrossSectionCalculationOn())
+  // Shared reader, histograms in the output of the maker owning it.
+  if(fReaderOwner && GetReader()->GetWeightUtils()->IsMCCrossSectionCalculationOn())
   {
     TList * templist =  GetReader()->GetWeightUtils()->GetCreateOutputHistograms();
       
@@ -880,21 +906,26 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   // Add control histograms in Reader
   // --------------------------------
   
-  TList * templist =  fReader->GetCreateControlHistograms();
-  templist->SetOwner(kFALSE); //Owner is fOutputContainer.
-    
-  for(Int_t ih = 0; ih < templist->GetEntries() ; ih++)
-  {        
-    //if ( fSumw2 ) ((TH1*) templist->At(ih))->Sumw2();
+  TList * templist = 0x0;
+  
+  if ( fReaderOwner )
+  {
+    templist =  fReader->GetCreateControlHistograms();
+    templist->SetOwner(kFALSE); //Owner is fOutputContainer.
     
-    //printf("histo %d %p %s\n",ih,templist->At(ih), templist->At(ih)->GetName());
+    for(Int_t ih = 0; ih < templist->GetEntries() ; ih++)
+    {        
+      //if ( fSumw2 ) ((TH1*) templist->At(ih))->Sumw2();
+      
+      //printf("histo %d %p %s\n",ih,templist->At(ih), templist->At(ih)->GetName());
+      
+      //Add histogram to general container
+      fOutputContainer->Add(templist->At(ih)) ;
+    }
     
-    //Add histogram to general container
-    fOutputContainer->Add(templist->At(ih)) ;
+    delete templist;
   }
   
-  delete templist;
-  
   // ------------------------
   // Add analysis histograms
   // ------------------------
@@ -948,6 +979,31 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   return fOutputContainer;
 }
 
+//_____________________________________________________________________________
+/// Use the reader of another maker. The reader lists, the event selection and
+/// the eta-phi index kinematics are then filled once per event by the first
+/// maker executed and used read-only by the others. The reader settings, its
+/// control histograms and its AOD branches clean-up are the ones of the maker
+/// owning it, which must be executed first. The analyses of the makers sharing
+/// a reader must use different AOD branch names.
+/// \param re: reader of the maker owning it.
+//_____________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::SetSharedReader(AliCaloTrackReader * re)
+{
+  if ( !re )
+  {
+    AliWarning("Null shared reader, not set");
+    return;
+  }
+  
+  if ( fReader && fReaderOwner && fReader != re ) delete fReader;
+  
+  fReader      = re;
+  fReaderOwner = kFALSE;
+  
+  fReader->SwitchOnSharedBetweenMakers();
+}
+
 //___________________________________
 /// Init container histograms and other common variables
 /// Fill the output list of histograms during the CreateOutputObjects stage.
@@ -960,10 +1016,22 @@ void AliAnaCaloTrackCorrMaker::Init()
   if ( fAnaDebug >= 0 )
     (AliAnalysisManager::GetAnalysisManager())->AddClassDebug(this->ClassName(),fAnaDebug);
 
-  // Initialize reader
-  GetReader()->Init();
+  AliCalorimeterUtils * caloUtils = GetCaloUtils();
+
+  // Initialize reader, done by the maker owning it if shared,
+  // which has to be initialised, and so executed, before the others
+  if ( fReaderOwner )
+  {
+    GetReader()->Init();
 
-  GetReader()->SetCaloUtils(GetCaloUtils()); // pass the calo utils pointer to the reader
+    GetReader()->SetCaloUtils(caloUtils); // pass the calo utils pointer to the reader
+    
+    GetReader()->SetOwnerInitialised();
+  }
+  else if ( !GetReader()->IsOwnerInitialised() )
+  {
+    AliFatal("Shared reader not initialised, the maker owning it must be added to the train before this one, STOP!");
+  }
 
   // Activate debug level in calo utils
   if ( fCaloUtils->GetDebug() >= 0 )
@@ -1020,6 +1088,7 @@ void AliAnaCaloTrackCorrMaker::Print(const Option_t * opt) const
   printf("Produce Histo              =     %d\n", fMakeHisto  ) ;
   printf("Produce AOD                =     %d\n", fMakeAOD    ) ;
   printf("Number of analysis tasks   =     %d\n", fAnalysisContainer->GetEntries()) ;
+  printf("Reader owner               =     %d\n", fReaderOwner) ;
   
   if(!strcmp("all",opt))
   {
@@ -1059,12 +1128,17 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   //printf("fAODBranchList %p, entries %d\n",fAODBranchList,fAODBranchList->GetEntries());
   
   // Each event needs an empty branch
-  TList * aodList = fReader->GetAODBranchList();
-  Int_t nAODBranches = aodList->GetEntries();
+  // Shared reader, each maker empties its own branches, also in events
+  // not executed by the others: the one owning the reader all its list
+  // except the branches of the makers sharing it
+  TList * aodList = fReaderOwner ? fReader->GetAODBranchList() : fAODBranchList;
+  Int_t nAODBranches = aodList ? aodList->GetEntries() : 0;
   for(Int_t iaod = 0; iaod < nAODBranches; iaod++)
   {
-	  TClonesArray *tca = dynamic_cast<TClonesArray*> (aodList->At(iaod));
-	  if(tca) tca->Clear("C");
+    TClonesArray *tca = dynamic_cast<TClonesArray*> (aodList->At(iaod));
+    if ( !tca ) continue;
+    if ( fReaderOwner && fReader->IsSharedAODBranch(tca) ) continue;
+    tca->Clear("C");
   }
   
   // Set geometry matrices before filling arrays, in case recalibration/position calculation etc is needed
@@ -1073,8 +1147,9 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   // Set the AODB calibration, bad channels etc. parameters at least once
   fCaloUtils->AccessOADB(fReader->GetInputEvent());
   
-  // Tell the reader to fill the data in the 3 detector lists
-  Bool_t ok = fReader->FillInputEvent(iEntry, currentFileName);
+  // Tell the reader to fill the data in the 3 detector lists,
+  // only once per event if the reader is shared with other makers
+  Bool_t ok = fReader->FillInputEventOnce(iEntry, currentFileName);
   
   // Access pointers, and trigger mask check needed in mixing case
   AliAnalysisManager   *manager      = AliAnalysisManager::GetAnalysisManager();
@@ -86,6 +86,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
 
   void    SetCaloUtils(AliCalorimeterUtils * cu) { fCaloUtils = cu ; }
   void    SetReader(AliCaloTrackReader * re)     { fReader = re    ; }
+  void    SetSharedReader(AliCaloTrackReader * re) ;
+  Bool_t  IsReaderOwner()            const { return fReaderOwner   ; }
   
   AliCaloTrackReader  * GetReader()        { if (!fReader)    fReader    = new AliCaloTrackReader () ;
                                              return fReader        ; }
@@ -111,6 +113,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   // General Data members
   
   AliCaloTrackReader  *  fReader ;                   ///<  Pointer to AliCaloTrackReader.
+  
+  Bool_t   fReaderOwner ;                            ///<  Reader created or set with SetReader(), not shared from another maker.
     
   AliCalorimeterUtils *  fCaloUtils ;                ///<  Pointer to AliCalorimeterUtils.
   
@@ -128,6 +132,8 @@ class AliAnaCaloTrackCorrMaker : public TObject {
     
   TList *  fCuts ;	                                 //!<! List with analysis cuts.
     
+  TList *  fAODBranchList ;                          //!<! List with the AOD branches of the analysis of this maker, shared reader case.
+    
   Double_t fScaleFactor ;                            ///<  Scaling factor needed for normalization.
     
   Int_t    fFillDataControlHisto;                    ///<  Fill histograms only interesting with data. 0 not filled; 1 basic control; 2+ trigger related
@@ -206,7 +212,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,28) ;
   /// \endcond
 
 } ;
@@ -164,8 +164,9 @@ void AliAnalysisTaskCaloTrackCorrelation::Init()
   // to avoid problems when reading MC generator particles
   AliPDG::AddParticlesToPdgDataBase();
   
-  // Set in the reader the name of the task in case is needed
-  (fAna->GetReader())->SetTaskName(GetName());
+  // Set in the reader the name of the task in case is needed,
+  // a shared reader keeps the settings of the task owning it
+  if ( fAna->IsReaderOwner() ) (fAna->GetReader())->SetTaskName(GetName());
 	
   // Initialise analysis
   fAna->Init();
@@ -174,8 +175,8 @@ void AliAnalysisTaskCaloTrackCorrelation::Init()
   if((fAna->GetReader())->GetDeltaAODFileName()!="")
     AliAnalysisManager::GetAnalysisManager()->RegisterExtraFile((fAna->GetReader())->GetDeltaAODFileName());
   
-  // Selected Trigger
-  if(fAna->GetReader()->IsEventTriggerAtSEOn()) fAna->GetReader()->SetEventTriggerMask(GetCollisionCandidates());
+  // Selected Trigger, the one of the task owning the reader if shared
+  if(fAna->IsReaderOwner() && fAna->GetReader()->IsEventTriggerAtSEOn()) fAna->GetReader()->SetEventTriggerMask(GetCollisionCandidates());
   
   AliDebug(1,"End");
 }
@@ -0,0 +1,195 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+#include <algorithm>
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackEtaPhiIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackEtaPhiIndex) ;
+/// \endcond
+
+//____________________________________
+/// Default constructor.
+//____________________________________
+AliCaloTrackEtaPhiIndex::AliCaloTrackEtaPhiIndex() :
+TObject(),
+fCellSize(0.1),
+fFilled(kFALSE),
+fObjects(), fPt(), fEta(), fPhi(), fID(),
+fEtaMin(0.),        fEtaCellSize(0.1),  fPhiCellSize(0.1),
+fNEtaCells(0),      fNPhiCells(0),
+fCellFirst(),       fCellParticles()
+{
+}
+
+//____________________________________
+/// Remove the content of the previous event.
+/// The memory of the arrays is kept for the next event.
+//____________________________________
+void AliCaloTrackEtaPhiIndex::Reset()
+{
+  fFilled = kFALSE;
+
+  fObjects.clear();
+  fPt     .clear();
+  fEta    .clear();
+  fPhi    .clear();
+  fID     .clear();
+
+  fNEtaCells = 0;
+  fNPhiCells = 0;
+
+  fCellFirst    .clear();
+  fCellParticles.clear();
+}
+
+//____________________________________________________________________
+/// Add an entry, in the order of the list it comes from.
+/// \param obj: track or cluster.
+/// \param pt: transverse momentum.
+/// \param eta: pseudorapidity.
+/// \param phi: azimuthal angle, in [0,2pi[.
+/// \param id: track or cluster ID.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiIndex::AddParticle(TObject * obj, Float_t pt, Float_t eta, Float_t phi, Int_t id)
+{
+  fObjects.push_back(obj);
+  fPt     .push_back(pt );
+  fEta    .push_back(eta);
+  fPhi    .push_back(phi);
+  fID     .push_back(id );
+}
+
+//____________________________________________________________________
+/// Sort the entries in (eta,phi) cells, to be called once all the
+/// particles of the event are added. The eta range is the one of the
+/// added particles; phi covers the full azimuth.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiIndex::MakeIndex()
+{
+  const Int_t kMaxEtaCells = 1000;
+
+  Int_t nParticles = fPt.size();
+
+  Float_t etaMax = 0.;
+  fEtaMin = 0.;
+  for(Int_t i = 0; i < nParticles; i++)
+  {
+    if(i == 0 || fEta[i] < fEtaMin) fEtaMin = fEta[i];
+    if(i == 0 || fEta[i] > etaMax ) etaMax  = fEta[i];
+  }
+
+  if(fCellSize <= 0) fCellSize = 0.1;
+
+  fEtaCellSize = fCellSize;
+  fNEtaCells   = 1;
+  if(etaMax > fEtaMin) fNEtaCells = TMath::Min(Int_t((etaMax-fEtaMin)/fEtaCellSize)+1, kMaxEtaCells);
+
+  fNPhiCells   = TMath::Max(Int_t(TMath::Ceil(TMath::TwoPi()/fCellSize)), 1);
+  fPhiCellSize = TMath::TwoPi()/fNPhiCells;
+
+  Int_t nCells = fNEtaCells*fNPhiCells;
+
+  // Count the entries per cell, then fill keeping the list order within each cell
+  fCellFirst.assign(nCells+1, 0);
+  std::vector<Int_t> cell(nParticles);
+  for(Int_t i = 0; i < nParticles; i++)
+  {
+    cell[i] = GetEtaCell(fEta[i])*fNPhiCells + GetPhiCell(fPhi[i]);
+    fCellFirst[cell[i]+1]++;
+  }
+
+  for(Int_t ic = 0; ic < nCells; ic++) fCellFirst[ic+1] += fCellFirst[ic];
+
+  fCellParticles.resize(nParticles);
+  std::vector<Int_t> next(fCellFirst.begin(), fCellFirst.end()-1);
+  for(Int_t i = 0; i < nParticles; i++) fCellParticles[next[cell[i]]++] = i;
+}
+
+//____________________________________________________________________
+/// \return eta cell of the grid, values out of range go to the first or last cell.
+//____________________________________________________________________
+Int_t AliCaloTrackEtaPhiIndex::GetEtaCell(Float_t eta) const
+{
+  Float_t x = (eta-fEtaMin)/fEtaCellSize;
+  if(!(x > 0))          return 0;
+  if(x >= fNEtaCells-1) return fNEtaCells-1;
+  return Int_t(x);
+}
+
+//____________________________________________________________________
+/// \return phi cell of the grid, angle wrapped to [0,2pi[.
+//____________________________________________________________________
+Int_t AliCaloTrackEtaPhiIndex::GetPhiCell(Float_t phi) const
+{
+  Float_t x = phi/fPhiCellSize;
+  if(!(x > -1e6 && x < 1e6)) return 0;
+  Int_t ic = Int_t(TMath::Floor(x)) % fNPhiCells;
+  if(ic < 0) ic += fNPhiCells;
+  return ic;
+}
+
+//____________________________________________________________________
+/// Get the entries that can be at a distance smaller than r from (etaC,phiC).
+/// The selection is done per cell with one cell margin, so the list contains
+/// all the particles in the cone and some around it; the exact distance has
+/// to be checked by the caller. Entries are returned in the list order.
+/// \param etaC: pseudorapidity of the cone axis.
+/// \param phiC: azimuthal angle of the cone axis.
+/// \param r: cone radius.
+/// \param particles: position of the entries, output.
+//____________________________________________________________________
+void AliCaloTrackEtaPhiIndex::GetParticlesInCone(Float_t etaC, Float_t phiC, Float_t r,
+                                                 std::vector<Int_t> & particles) const
+{
+  particles.clear();
+
+  if(fNEtaCells <= 0 || fNPhiCells <= 0) return;
+
+  Int_t etaFirst = TMath::Max(GetEtaCell(etaC-r)-1, 0);
+  Int_t etaLast  = TMath::Min(GetEtaCell(etaC+r)+1, fNEtaCells-1);
+
+  Int_t phiFirst = 0;
+  Int_t phiLast  = fNPhiCells-1;
+  if(r < TMath::Pi() && TMath::Abs(phiC) < 2*TMath::TwoPi())
+  {
+    phiFirst = Int_t(TMath::Floor((phiC-r)/fPhiCellSize))-1;
+    phiLast  = Int_t(TMath::Floor((phiC+r)/fPhiCellSize))+1;
+  }
+  if(phiLast-phiFirst+1 >= fNPhiCells)
+  {
+    phiFirst = 0;
+    phiLast  = fNPhiCells-1;
+  }
+
+  for(Int_t ieta = etaFirst; ieta <= etaLast; ieta++)
+  {
+    for(Int_t iphi = phiFirst; iphi <= phiLast; iphi++)
+    {
+      Int_t jphi = iphi % fNPhiCells;
+      if(jphi < 0) jphi += fNPhiCells;
+
+      Int_t ic = ieta*fNPhiCells + jphi;
+      for(Int_t ip = fCellFirst[ic]; ip < fCellFirst[ic+1]; ip++)
+        particles.push_back(fCellParticles[ip]);
+    }
+  }
+
+  std::sort(particles.begin(), particles.end());
+}
@@ -0,0 +1,99 @@
+#ifndef ALICALOTRACKETAPHIINDEX_H
+#define ALICALOTRACKETAPHIINDEX_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackEtaPhiIndex
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Per event kinematics and (eta,phi) grid of a list of tracks or clusters.
+///
+/// Filled by AliCaloTrackReader once per event for its CTS and calorimeter
+/// lists, on first request. It keeps pT, eta, phi (in [0,2pi[) and ID of each
+/// entry of the list, in the list order, and an index of the entries per
+/// (eta,phi) cell so that the particles around a given direction, e.g. in an
+/// isolation cone, can be retrieved without looping over the full list.
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <vector>
+
+class AliCaloTrackEtaPhiIndex : public TObject {
+
+ public:
+
+  AliCaloTrackEtaPhiIndex() ;
+
+  /// Virtual destructor.
+  virtual ~AliCaloTrackEtaPhiIndex() { ; }
+
+  void       Reset() ;
+
+  void       AddParticle(TObject * obj, Float_t pt, Float_t eta, Float_t phi, Int_t id) ;
+
+  void       MakeIndex() ;
+
+  void       GetParticlesInCone(Float_t etaC, Float_t phiC, Float_t r, std::vector<Int_t> & particles) const ;
+
+  // Getters and setters
+
+  Bool_t     IsFilled()               const { return fFilled                ; }
+  void       SetFilled(Bool_t f)            { fFilled = f                   ; }
+
+  Int_t      GetNParticles()          const { return fPt.size()             ; }
+  TObject *  GetObject(Int_t i)       const { return fObjects[i]            ; }
+  Float_t    GetPt(Int_t i)           const { return fPt[i]                 ; }
+  Float_t    GetEta(Int_t i)          const { return fEta[i]                ; }
+  Float_t    GetPhi(Int_t i)          const { return fPhi[i]                ; }
+  Int_t      GetID(Int_t i)           const { return fID[i]                 ; }
+
+  Float_t    GetCellSize()            const { return fCellSize              ; }
+  void       SetCellSize(Float_t s)         { fCellSize = s                 ; }
+
+ private:
+
+  Int_t      GetEtaCell(Float_t eta)  const ;
+  Int_t      GetPhiCell(Float_t phi)  const ;
+
+  Float_t    fCellSize ;                    ///< Approximate size of the (eta,phi) cells
+
+  Bool_t     fFilled ;                      //!<! Content refers to the current event
+
+  std::vector<TObject*> fObjects ;          //!<! Track or cluster of each entry
+
+  std::vector<Float_t>  fPt ;               //!<! pT of each entry
+
+  std::vector<Float_t>  fEta ;              //!<! Pseudorapidity of each entry
+
+  std::vector<Float_t>  fPhi ;              //!<! Azimuthal angle of each entry, in [0,2pi[
+
+  std::vector<Int_t>    fID ;               //!<! Track or cluster ID of each entry
+
+  Float_t    fEtaMin ;                      //!<! Lower eta edge of the grid
+
+  Float_t    fEtaCellSize ;                 //!<! Eta size of the cells
+
+  Float_t    fPhiCellSize ;                 //!<! Phi size of the cells
+
+  Int_t      fNEtaCells ;                   //!<! Number of cells in eta
+
+  Int_t      fNPhiCells ;                   //!<! Number of cells in phi
+
+  std::vector<Int_t>    fCellFirst ;        //!<! First position of each cell in fCellParticles, one more entry for the end
+
+  std::vector<Int_t>    fCellParticles ;    //!<! Entries sorted by cell, in list order within a cell
+
+  /// Copy constructor not implemented.
+  AliCaloTrackEtaPhiIndex(              const AliCaloTrackEtaPhiIndex & g) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackEtaPhiIndex & operator = (const AliCaloTrackEtaPhiIndex & g) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackEtaPhiIndex,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKETAPHIINDEX_H
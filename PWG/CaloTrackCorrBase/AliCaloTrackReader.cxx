@@ -17,6 +17,7 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -45,6 +46,7 @@
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
 #include "AliMCAnalysisUtils.h"
+#include "AliCaloTrackEtaPhiIndex.h"
 
 // ---- Jets ----
 #include "AliAODJet.h"
@@ -139,12 +141,16 @@ fhEMCALClusterEtaPhi(0),     fhEMCALClusterEtaPhiFidCut(0),
 fhEMCALClusterTimeE(0),
 fEnergyHistogramNbins(0),
 fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeaderToAccept(""),
-fGenEventHeader(0),          fGenPythiaEventHeader(0)
+fGenEventHeader(0),          fGenPythiaEventHeader(0),
+fSharedBetweenMakers(0),     fFilledEntry(-1),
+fFilledInputEvent(0),        fFilledEventAccepted(0),
+fOwnerInitialised(0),        fSharedAODBranchList(0)
 {
   for(Int_t i = 0; i < 8; i++) fhEMCALClusterCutsE [i]= 0x0 ;    
   for(Int_t i = 0; i < 7; i++) fhPHOSClusterCutsE  [i]= 0x0 ;  
   for(Int_t i = 0; i < 6; i++) fhCTSTrackCutsPt    [i]= 0x0 ;    
   for(Int_t j = 0; j < 5; j++) { fMCGenerToAccept  [j] =  ""; fMCGenerIndexToAccept[j] = -1; }
+  for(Int_t i = 0; i < 4; i++) fEtaPhiIndex        [i]= 0x0 ;
   
   InitParameters();
 }
@@ -171,6 +177,8 @@ void AliCaloTrackReader::DeletePointers()
     delete fAODBranchList ;
   }
   
+  delete fSharedAODBranchList ; // not owner of the branches
+  
   if(fCTSTracks)
   {
     if(fDataType!=kMC)fCTSTracks->Clear() ;
@@ -226,6 +234,12 @@ void AliCaloTrackReader::DeletePointers()
     
   if ( fMCUtils     ) delete fMCUtils ; 
 
+  for(Int_t i = 0; i < 4; i++)
+  {
+    delete fEtaPhiIndex[i] ;
+    fEtaPhiIndex[i] = 0x0 ;
+  }
+
   //  Pointers not owned, done by the analysis frame
   //  if(fInputEvent)  delete fInputEvent ;
   //  if(fOutputEvent) delete fOutputEvent ;
@@ -1288,6 +1302,8 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   fIsTriggerMatchOpenCut[1] = kFALSE ;
   fIsTriggerMatchOpenCut[2] = kFALSE ;
   
+  ResetEtaPhiIndex();
+  
   //fCurrentFileName = TString(currentFileName);
   if(!fInputEvent)
   {
@@ -3156,6 +3172,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
     printf("Compare cluster pt and pt hard to accept event, factor = %2.2f",fPtHardAndClusterPtFactor);
   
   printf("Delta AOD File Name =     %s\n", fDeltaAODFileName.Data()) ;
+  printf("Shared between makers =   %d\n", fSharedBetweenMakers) ;
   printf("Centrality: Class %s, Option %d, Bin [%d,%d] \n", fCentralityClass.Data(),fCentralityOpt,fCentralityBin[0], fCentralityBin[1]) ;
   
   printf("    \n") ;
@@ -3271,6 +3288,18 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
 /// Reset lists, called in AliAnaCaloTrackCorrMaker.
 //___________________________________
 void AliCaloTrackReader::ResetLists()
+{  
+  // Lists used by several makers, the next maker still needs them.
+  // Reset when the next event is filled, see FillInputEventOnce().
+  if ( fSharedBetweenMakers ) return;
+  
+  ClearLists();
+}
+
+//___________________________________
+/// Clear the lists, V0 and jets of the event.
+//___________________________________
+void AliCaloTrackReader::ClearLists()
 {  
   if(fCTSTracks)       fCTSTracks     -> Clear();
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
@@ -3281,6 +3310,160 @@ void AliCaloTrackReader::ResetLists()
   
   if(fNonStandardJets) fNonStandardJets -> Clear("C");
   fBackgroundJets->Reset();
+  
+  ResetEtaPhiIndex();
+}
+
+//______________________________________________________________________________
+/// Register an AOD branch of a maker sharing the reader. The maker owning
+/// the reader does not empty it, the sharing maker does.
+/// \param branch: AOD branch, also in the list of GetAODBranchList().
+//______________________________________________________________________________
+void AliCaloTrackReader::AddSharedAODBranch(TObject * branch)
+{
+  if ( !fSharedAODBranchList ) 
+  {
+    fSharedAODBranchList = new TList();
+    fSharedAODBranchList->SetOwner(kFALSE);
+  }
+  
+  fSharedAODBranchList->Add(branch);
+}
+
+//______________________________________________________________________________
+/// \return kTRUE if the AOD branch belongs to a maker sharing the reader.
+//______________________________________________________________________________
+Bool_t AliCaloTrackReader::IsSharedAODBranch(TObject * branch) const
+{
+  if ( !fSharedAODBranchList ) return kFALSE;
+  
+  return (fSharedAODBranchList->FindObject(branch) != 0x0);
+}
+
+//______________________________________________________________________________
+/// Fill the lists with FillInputEvent(). In case the reader is shared
+/// between several makers, only the first maker executed for a given event
+/// fills the lists; the others get the lists, the eta-phi index kinematics and
+/// the event selection decision of that first call.
+/// \return kTRUE if the event is accepted.
+//______________________________________________________________________________
+Bool_t AliCaloTrackReader::FillInputEventOnce(Int_t iEntry, const char * currentFileName)
+{
+  if ( !fSharedBetweenMakers ) return FillInputEvent(iEntry, currentFileName);
+  
+  // Entry in the full chain, iEntry may be the entry in the current file
+  Long64_t entry = iEntry;
+  AliAnalysisManager * manager = AliAnalysisManager::GetAnalysisManager();
+  if ( manager ) entry = manager->GetCurrentEntry();
+  
+  if ( entry == fFilledEntry && fInputEvent == fFilledInputEvent )
+  {
+    AliDebug(1,Form("Lists of event %d already filled",iEntry));
+    return fFilledEventAccepted;
+  }
+  
+  ClearLists();
+  
+  fFilledEntry         = entry;
+  fFilledInputEvent    = fInputEvent;
+  fFilledEventAccepted = FillInputEvent(iEntry, currentFileName);
+  
+  return fFilledEventAccepted;
+}
+
+//___________________________________
+/// Invalidate the eta-phi index of the lists,
+/// called when the lists change.
+//___________________________________
+void AliCaloTrackReader::ResetEtaPhiIndex()
+{
+  for(Int_t i = 0; i < 4; i++)
+  {
+    if(fEtaPhiIndex[i]) fEtaPhiIndex[i]->Reset();
+  }
+}
+
+//______________________________________________________________________________
+/// Kinematics and (eta,phi) grid of one of the reader lists, filled on the first
+/// call in the event and shared afterwards by all the analyses using the reader.
+/// Tracks kinematics from their momentum, clusters from AliVCluster::GetMomentum
+/// with the vertex of their event, azimuth in [0,2pi[.
+///
+/// \param list: one of the CTS, EMCAL, DCAL or PHOS lists of this reader.
+/// \return index of the list, 0 if the list is not one of the reader lists
+/// or does not contain only tracks or clusters.
+//______________________________________________________________________________
+AliCaloTrackEtaPhiIndex * AliCaloTrackReader::GetEtaPhiIndex(TObjArray * list)
+{
+  if(!list) return 0x0;
+
+  Int_t det = -1;
+  if     ( list == fEMCALClusters ) det = kEMCAL;
+  else if( list == fPHOSClusters  ) det = kPHOS;
+  else if( list == fCTSTracks     ) det = kCTS;
+  else if( list == fDCALClusters  ) det = kDCAL;
+  else return 0x0;
+
+  if(!fEtaPhiIndex[det]) fEtaPhiIndex[det] = new AliCaloTrackEtaPhiIndex();
+
+  AliCaloTrackEtaPhiIndex * index = fEtaPhiIndex[det];
+
+  Int_t nEntries = list->GetEntries();
+
+  if(!index->IsFilled())
+  {
+    index->Reset();
+
+    TVector3       trackVector;
+    TLorentzVector momentum;
+
+    for(Int_t i = 0; i < nEntries; i++)
+    {
+      Float_t pt  = 0;
+      Float_t eta = 0;
+      Float_t phi = 0;
+      Int_t   id  = -1;
+
+      if(det == kCTS)
+      {
+        AliVTrack * track = dynamic_cast<AliVTrack*>(list->At(i));
+        if(!track) break;
+
+        trackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        pt  = trackVector.Pt();
+        eta = trackVector.Eta();
+        phi = trackVector.Phi();
+        id  = GetTrackID(track);
+      }
+      else
+      {
+        AliVCluster * calo = dynamic_cast<AliVCluster*>(list->At(i));
+        if(!calo) break;
+
+        Int_t evtIndex = 0 ;
+        if (GetMixedEvent())
+          evtIndex=GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+
+        calo->GetMomentum(momentum,GetVertex(evtIndex)) ;
+        pt  = momentum.Pt();
+        eta = momentum.Eta();
+        phi = momentum.Phi();
+        id  = calo->GetID();
+      }
+
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+
+      index->AddParticle(list->At(i), pt, eta, phi, id);
+    }
+
+    index->MakeIndex();
+    index->SetFilled(kTRUE);
+  }
+
+  // Not usable if some entry was not a track or cluster
+  if(index->GetNParticles() != nEntries) return 0x0;
+
+  return index;
 }
 
 //___________________________________________
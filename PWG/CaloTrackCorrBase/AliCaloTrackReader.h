@@ -54,6 +54,7 @@ class AliVCluster;
 class AliCalorimeterUtils;
 #include "AliAnaWeights.h"
 #include "AliMCAnalysisUtils.h"
+class AliCaloTrackEtaPhiIndex;
 
 // Jets
 class AliAODJetEventBackground;
@@ -77,6 +78,17 @@ public:
   virtual void    Print(const Option_t * opt) const;
   
   virtual void    ResetLists();
+  
+  void            ClearLists();
+  
+  // Reader used by several AliAnaCaloTrackCorrMaker
+  void            SwitchOnSharedBetweenMakers()            { fSharedBetweenMakers = kTRUE  ; }
+  void            SwitchOffSharedBetweenMakers()           { fSharedBetweenMakers = kFALSE ; }
+  Bool_t          IsSharedBetweenMakers()            const { return fSharedBetweenMakers   ; }
+  void            SetOwnerInitialised()                    { fOwnerInitialised = kTRUE     ; }
+  Bool_t          IsOwnerInitialised()               const { return fOwnerInitialised      ; }
+  void            AddSharedAODBranch(TObject * branch) ;
+  Bool_t          IsSharedAODBranch(TObject * branch) const ;
 
   virtual Int_t   GetDebug()                         const { return fDebug                 ; }
   virtual void    SetDebug(Int_t d)                        { fDebug = d                    ; }
@@ -285,6 +297,7 @@ public:
   // Filling/ filtering / detector information access methods
   
   virtual Bool_t   FillInputEvent(Int_t iEntry, const char *currentFileName)  ;
+  Bool_t           FillInputEventOnce(Int_t iEntry, const char *currentFileName)  ;
   virtual void     FillInputCTS() ;
   virtual void     FillInputEMCAL() ;
   virtual void     FillInputEMCALAlgorithm(AliVCluster * clus, Int_t iclus) ;
@@ -310,6 +323,9 @@ public:
   virtual TObjArray*     GetPHOSClusters()           const { return fPHOSClusters           ; }
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
+
+  AliCaloTrackEtaPhiIndex * GetEtaPhiIndex(TObjArray * list) ;
+  void             ResetEtaPhiIndex() ;
   
   //-------------------------------------
   // Event/track selection methods
@@ -1013,6 +1029,20 @@ public:
   
   AliGenEventHeader       * fGenEventHeader;       //!<! Event header
   AliGenPythiaEventHeader * fGenPythiaEventHeader; //!<! Event header casted to pythia
+
+  AliCaloTrackEtaPhiIndex * fEtaPhiIndex[4];       //!<! Kinematics and eta-phi grid of the EMCAL, PHOS, CTS and DCAL lists, filled on demand once per event
+  
+  Bool_t           fSharedBetweenMakers;           ///<  Lists filled once per event and used by several makers, reset when the next event is filled.
+  
+  Long64_t         fFilledEntry;                   //!<! Entry of the event in the lists, shared reader case.
+  
+  AliVEvent      * fFilledInputEvent;              //!<! Input event in the lists, shared reader case.
+  
+  Bool_t           fFilledEventAccepted;           //!<! Result of FillInputEvent() for the event in the lists, shared reader case.
+  
+  Bool_t           fOwnerInitialised;              //!<! Reader initialised by the maker owning it, shared reader case.
+  
+  TList          * fSharedAODBranchList;           //!<! AOD branches of the makers sharing the reader, emptied by them each event. Not owner.
   
   /// Copy constructor not implemented.
   AliCaloTrackReader(              const AliCaloTrackReader & r) ; 
@@ -1021,7 +1051,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,81) ;
+  ClassDef(AliCaloTrackReader,83) ;
   /// \endcond
 
 } ;
@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackEtaPhiIndex.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -53,8 +54,10 @@ fDebug(0),
 fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
+fUseEtaPhiIndex(kTRUE),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fParticlesInCone()
 {
   InitParameters();
 }
@@ -375,6 +378,8 @@ TString AliIsolationCut::GetICParametersList()
   parList+=onePar ;
   snprintf(onePar,buffersize,"fDistMinToTrigger=%1.2f \n",fDistMinToTrigger) ;
   parList+=onePar ;
+  snprintf(onePar,buffersize,"fUseEtaPhiIndex=%d \n",fUseEtaPhiIndex) ;
+  parList+=onePar ;
 
   return parList;
 }
@@ -457,6 +462,10 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   Int_t       ntrackrefs   = 0;
   Int_t       nclusterrefs = 0;
   
+  // Out of cone bands only needed for kSumBkgSubIC, otherwise when the
+  // reader eta-phi index is available only check the particles around the cone
+  Bool_t onlyAroundCone = (fICMethod != kSumBkgSubIC);
+  
   // --------------------------------
   // Check charged tracks in cone.
   // --------------------------------
@@ -464,8 +473,22 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    // Kinematics of the reader tracks calculated once per event
+    AliCaloTrackEtaPhiIndex * trackIndex = 0x0;
+    if ( fUseEtaPhiIndex && reader ) trackIndex = reader->GetEtaPhiIndex(plCTS);
+    
+    Int_t ntracks = plCTS->GetEntries();
+    if ( trackIndex && onlyAroundCone )
+    {
+      trackIndex->GetParticlesInCone(etaC, phiC, fConeSize, fParticlesInCone);
+      ntracks = fParticlesInCone.size();
+    }
+    
+    for(Int_t itr = 0;itr < ntracks ; itr ++ )
     {
+      Int_t ipr = itr;
+      if ( trackIndex && onlyAroundCone ) ipr = fParticlesInCone[itr];
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -475,7 +498,9 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
         // in the isolation conte
         if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS ) // make sure conversions are tagged as kCTS!!!
         {
-          Int_t  trackID   = reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
+          Int_t  trackID   = -1;
+          if ( trackIndex ) trackID = trackIndex->GetID(ipr);
+          else              trackID = reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
           Bool_t contained = kFALSE;
           
           for(Int_t i = 0; i < 4; i++) 
@@ -486,10 +511,19 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
           if ( contained ) continue ;
         }
         
-        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-        pt  = fTrackVector.Pt();
-        eta = fTrackVector.Eta();
-        phi = fTrackVector.Phi() ;
+        if ( trackIndex )
+        {
+          pt  = trackIndex->GetPt (ipr);
+          eta = trackIndex->GetEta(ipr);
+          phi = trackIndex->GetPhi(ipr);
+        }
+        else
+        {
+          fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+          pt  = fTrackVector.Pt();
+          eta = fTrackVector.Eta();
+          phi = fTrackVector.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliCaloTrackParticles
@@ -609,19 +643,26 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plNe &&
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
+    // Kinematics of the reader clusters calculated once per event
+    AliCaloTrackEtaPhiIndex * caloIndex = 0x0;
+    if ( fUseEtaPhiIndex && reader ) caloIndex = reader->GetEtaPhiIndex(plNe);
+    
+    Int_t nclusters = plNe->GetEntries();
+    if ( caloIndex && onlyAroundCone )
+    {
+      caloIndex->GetParticlesInCone(etaC, phiC, fConeSize, fParticlesInCone);
+      nclusters = fParticlesInCone.size();
+    }
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    for(Int_t icl = 0;icl < nclusters ; icl ++ )
     {
+      Int_t ipr = icl;
+      if ( caloIndex && onlyAroundCone ) ipr = fParticlesInCone[icl];
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
       {
-        // Get the index where the cluster comes, to retrieve the corresponding vertex
-        Int_t evtIndex = 0 ;
-        if (reader->GetMixedEvent())
-          evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
-        
-        
         // Do not count the candidate (photon or pi0) or the daughters of the candidate
         if(calo->GetID() == pCandidate->GetCaloLabel(0) ||
            calo->GetID() == pCandidate->GetCaloLabel(1)   ) continue ;
@@ -633,12 +674,26 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
              pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
         }
         
-        // Assume that come from vertex in straight line
-        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-        
-        pt  = fMomentum.Pt()  ;
-        eta = fMomentum.Eta() ;
-        phi = fMomentum.Phi() ;
+        if ( caloIndex )
+        {
+          pt  = caloIndex->GetPt (ipr);
+          eta = caloIndex->GetEta(ipr);
+          phi = caloIndex->GetPhi(ipr);
+        }
+        else
+        {
+          // Get the index where the cluster comes, to retrieve the corresponding vertex
+          Int_t evtIndex = 0 ;
+          if (reader->GetMixedEvent())
+            evtIndex=reader->GetMixedEvent()->EventIndexForCaloCluster(calo->GetID()) ;
+          
+          // Assume that come from vertex in straight line
+          calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+          
+          pt  = fMomentum.Pt()  ;
+          eta = fMomentum.Eta() ;
+          phi = fMomentum.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliCaloTrackParticles
@@ -900,6 +955,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   printf("particle type in cone =  %d\n",    fPartInCone ) ;
   printf("using fraction for high pt leading instead of frac ? %i\n",fFracIsThresh);
   printf("minimum distance to candidate, R>%1.2f\n",fDistMinToTrigger);
+  printf("use reader eta-phi index? %d\n",fUseEtaPhiIndex);
   printf("    \n") ;
 }
 
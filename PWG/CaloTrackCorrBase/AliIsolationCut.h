@@ -22,6 +22,7 @@
 #include <TObject.h>
 class TObjArray ;
 #include <TLorentzVector.h>
+#include <vector>
 
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
@@ -109,6 +110,10 @@ class AliIsolationCut : public TObject {
   void       SetFracIsThresh(Bool_t f )                        { fFracIsThresh      = f    ; }
   void       SetTrackMatchedClusterRejectionInCone(Bool_t tm)  { fIsTMClusterInConeRejected = tm ; }
   void       SetMinDistToTrigger(Float_t md)                   { fDistMinToTrigger  = md   ; }
+
+  void       SwitchOnEtaPhiIndex()                             { fUseEtaPhiIndex    = kTRUE  ; }
+  void       SwitchOffEtaPhiIndex()                            { fUseEtaPhiIndex    = kFALSE ; }
+  Bool_t     IsEtaPhiIndexUsed()                         const { return fUseEtaPhiIndex    ; }
     
  private:
 
@@ -136,10 +141,14 @@ class AliIsolationCut : public TObject {
   
   Float_t    fDistMinToTrigger;  ///<  Minimal distance between isolation candidate particle and particles in cone to count them for this isolation.
   
+  Bool_t     fUseEtaPhiIndex;    ///<  Take the kinematics of the reader tracks and clusters and the particles around the cone from the reader eta-phi index.
+  
   TLorentzVector fMomentum;      //!<! Momentum of cluster, temporal object.
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  std::vector<Int_t> fParticlesInCone; //!<! Position in the list of the particles around the cone, temporal container.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -147,7 +156,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
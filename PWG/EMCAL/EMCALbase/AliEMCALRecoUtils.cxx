@@ -75,7 +75,11 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fCutRequireTPCRefit(kFALSE),            fCutRequireITSRefit(kFALSE),            fCutAcceptKinkDaughters(kFALSE),
   fCutMaxDCAToVertexXY(0),                fCutMaxDCAToVertexZ(0),                 fCutDCAToVertex2D(kFALSE),
   fCutRequireITSStandAlone(kFALSE),       fCutRequireITSpureSA(kFALSE),             
-  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1)
+  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1),
+  fCellIndexGeom(0x0),                    fCellIndexSM(),                         fCellIndexEta(),
+  fCellIndexPhi(),                        fCellCross(),
+  fCellCalibTableOK(kFALSE),              fCellCalibGeom(0x0),                    fCellCalibSM(),
+  fCellCalibStatus(),                     fCellCalibEnergy(),                     fCellCalibTime()
 {
   // Init parameters
   InitParameters();
@@ -137,7 +141,13 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fCutAcceptKinkDaughters(reco.fCutAcceptKinkDaughters),     fCutMaxDCAToVertexXY(reco.fCutMaxDCAToVertexXY),    
   fCutMaxDCAToVertexZ(reco.fCutMaxDCAToVertexZ),             fCutDCAToVertex2D(reco.fCutDCAToVertex2D),
   fCutRequireITSStandAlone(reco.fCutRequireITSStandAlone),   fCutRequireITSpureSA(reco.fCutRequireITSpureSA),
-  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack)
+  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack),
+  fCellIndexGeom(reco.fCellIndexGeom),                       fCellIndexSM(reco.fCellIndexSM),
+  fCellIndexEta(reco.fCellIndexEta),                         fCellIndexPhi(reco.fCellIndexPhi),
+  fCellCross(reco.fCellCross),
+  fCellCalibTableOK(reco.fCellCalibTableOK),                 fCellCalibGeom(reco.fCellCalibGeom),
+  fCellCalibSM(reco.fCellCalibSM),                           fCellCalibStatus(reco.fCellCalibStatus),
+  fCellCalibEnergy(reco.fCellCalibEnergy),                   fCellCalibTime(reco.fCellCalibTime)
 {  
   for (Int_t i = 0; i < 15 ; i++) { fMisalRotShift[i]      = reco.fMisalRotShift[i]      ; 
                                     fMisalTransShift[i]    = reco.fMisalTransShift[i]    ; }
@@ -253,6 +263,19 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   for (Int_t j = 0; j < 5  ; j++)  
     fMCGenerToAccept[j]     = reco.fMCGenerToAccept[j];
 
+  fCellIndexGeom             = reco.fCellIndexGeom;
+  fCellIndexSM               = reco.fCellIndexSM;
+  fCellIndexEta              = reco.fCellIndexEta;
+  fCellIndexPhi              = reco.fCellIndexPhi;
+  fCellCross                 = reco.fCellCross;
+  
+  fCellCalibTableOK          = reco.fCellCalibTableOK;
+  fCellCalibGeom             = reco.fCellCalibGeom;
+  fCellCalibSM               = reco.fCellCalibSM;
+  fCellCalibStatus           = reco.fCellCalibStatus;
+  fCellCalibEnergy           = reco.fCellCalibEnergy;
+  fCellCalibTime             = reco.fCellCalibTime;
+
   //
   // Assign or copy construct the different TArrays
   //
@@ -409,16 +432,14 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   if ( absID < 0 || absID >= 24*48*geom->GetNumberOfSuperModules() ) 
     return kFALSE;
   
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0; 
+  Int_t imod = -1, iphi =-1, ieta=-1, status=0; 
   
-  if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) 
+  if (!GetCellIndexes(geom,absID,imod,ieta,iphi)) 
   {
     // cell absID does not exist
     amp=0; time = 1.e9;
     return kFALSE; 
   }
-  
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
 
   // Do not include bad channels found in analysis,
   if ( IsBadChannelsRemovalSwitchedOn() )
@@ -561,13 +582,10 @@ Bool_t AliEMCALRecoUtils::ClusterContainsBadChannel(const AliEMCALGeometry* geom
   for (Int_t iCell = 0; iCell<nCells; iCell++) 
   {
     //Get the column and row
-    Int_t iTower = -1, iIphi = -1, iIeta = -1; 
-    geom->GetCellIndex(cellList[iCell],imod,iTower,iIphi,iIeta); 
+    GetCellIndexes(geom,cellList[iCell],imod,icol,irow); 
   
     if (fEMCALBadChannelMap->GetEntries() <= imod) continue;
     
-    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);      
-    
     Int_t status = 0;
     if (GetEMCALChannelStatus(imod, icol, irow, status)) 
     {
@@ -602,42 +620,29 @@ Float_t AliEMCALRecoUtils::GetECross(Int_t absID, Double_t tcell,
     return -1;
   }
 
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
-  geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta); 
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
-  
-  // Get close cells index, energy and time, not in corners
-  
-  Int_t absID1 = -1;
-  Int_t absID2 = -1;
+  // Get close cells index, energy and time, not in corners, from the cell index table
+  // (computed on the fly only for cells outside the table)
   
-  if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absID1 = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
-  if ( iphi > 0 )                                absID2 = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
+  Int_t absIDCross[4] = {-1, -1, -1, -1};
   
-  // In case of cell in eta = 0 border, depending on SM shift the cross cell index
-  
-  Int_t absID3 = -1;
-  Int_t absID4 = -1;
-  
-  if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) ) 
-  {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod+1, iphi, 0);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta-1); 
-  } 
-  else if ( ieta == 0 && imod%2 ) 
+  if ( InitCellIndexTable(geom) && absID >= 0 && absID < (Int_t)fCellIndexSM.size() && fCellIndexSM[absID] >= 0 )
   {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta+1);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod-1, iphi, AliEMCALGeoParams::fgkEMCALCols-1); 
-  } 
-  else 
+    for (Int_t i = 0; i < 4; i++) absIDCross[i] = fCellCross[4*absID+i];
+  }
+  else
   {
-    if ( ieta < AliEMCALGeoParams::fgkEMCALCols-1 ) 
-      absID3 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta+1);
-    if ( ieta > 0 )                                 
-      absID4 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1); 
+    Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
+    geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta); 
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
+    GetCrossCells(geom, imod, iphi, ieta, absIDCross);
   }
   
-  //printf("IMOD %d, AbsId %d, a %d, b %d, c %d e %d \n",imod,absID,absID1,absID2,absID3,absID4);
+  Int_t absID1 = absIDCross[0];
+  Int_t absID2 = absIDCross[1];
+  Int_t absID3 = absIDCross[2];
+  Int_t absID4 = absIDCross[3];
+  
+  //printf("AbsId %d, a %d, b %d, c %d e %d \n",absID,absID1,absID2,absID3,absID4);
   
   Float_t  ecell1  = 0, ecell2  = 0, ecell3  = 0, ecell4  = 0;
   Double_t tcell1  = 0, tcell2  = 0, tcell3  = 0, tcell4  = 0;
@@ -1291,6 +1296,119 @@ Bool_t AliEMCALRecoUtils::GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iR
   return kFALSE; // if everything fails, accept it.
 }
 
+///
+/// Fill the cell index table: super module, column and row of each cell
+/// and its cross neighbours as used in GetECross(). Built once per geometry, 
+/// it replaces the AliEMCALGeometry calls per cell in the cluster loops.
+///
+/// \param geom: AliEMCALGeometry pointer
+///
+/// \return bool, true if the table is available
+///
+//____________________________________________________________________
+Bool_t AliEMCALRecoUtils::InitCellIndexTable(const AliEMCALGeometry *geom)
+{
+  if (!geom) return kFALSE;
+  
+  if (geom == fCellIndexGeom) return kTRUE;
+  
+  Int_t nCells = geom->GetNCells();
+  if (nCells <= 0) return kFALSE;
+  
+  fCellIndexSM .assign(nCells, -1);
+  fCellIndexEta.assign(nCells, -1);
+  fCellIndexPhi.assign(nCells, -1);
+  fCellCross   .assign(4*nCells, -1);
+  
+  for (Int_t absId = 0; absId < nCells; absId++)
+  {
+    Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
+    if (!geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta)) continue;
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
+    
+    fCellIndexSM [absId] = imod;
+    fCellIndexEta[absId] = ieta;
+    fCellIndexPhi[absId] = iphi;
+    
+    GetCrossCells(geom, imod, iphi, ieta, &fCellCross[4*absId]);
+  }
+  
+  AliDebug(1,Form("Cell index table built for %d cells",nCells));
+  
+  fCellIndexGeom = geom;
+  
+  return kTRUE;
+}
+
+///
+/// Get the super module, column and row of a cell, from the cell index 
+/// table or, for cells not in the table, from the geometry.
+///
+/// \param geom: AliEMCALGeometry pointer
+/// \param absId: cell absolute ID number
+/// \param iSupMod: super module number
+/// \param ieta: column number
+/// \param iphi: row number
+///
+/// \return bool, false if the cell does not exist
+///
+//____________________________________________________________________
+Bool_t AliEMCALRecoUtils::GetCellIndexes(const AliEMCALGeometry *geom, Int_t absId, 
+                                         Int_t & iSupMod, Int_t & ieta, Int_t & iphi)
+{
+  if ( InitCellIndexTable(geom) && absId >= 0 && absId < (Int_t)fCellIndexSM.size() && fCellIndexSM[absId] >= 0 )
+  {
+    iSupMod = fCellIndexSM [absId];
+    ieta    = fCellIndexEta[absId];
+    iphi    = fCellIndexPhi[absId];
+    return kTRUE;
+  }
+  
+  Int_t iTower = -1, iIphi = -1, iIeta = -1; 
+  if (!geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta)) return kFALSE; 
+  
+  geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi, iIeta,iphi,ieta);
+  
+  return kTRUE;
+}
+
+///
+/// Get the cells in the cross around a given cell, not in corners.
+/// In case of cell in eta = 0 border, depending on SM shift the cross cell index.
+///
+/// \param geom: AliEMCALGeometry pointer
+/// \param imod: super module number of the cell
+/// \param iphi: row number of the cell
+/// \param ieta: column number of the cell
+/// \param absIDs: absolute ID of the 4 cells in the cross, -1 if none
+///
+//____________________________________________________________________
+void AliEMCALRecoUtils::GetCrossCells(const AliEMCALGeometry *geom, Int_t imod, Int_t iphi, Int_t ieta, Int_t *absIDs) const
+{
+  absIDs[0] = absIDs[1] = absIDs[2] = absIDs[3] = -1;
+  
+  if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absIDs[0] = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
+  if ( iphi > 0 )                                absIDs[1] = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
+  
+  if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) ) 
+  {
+    absIDs[2] = geom-> GetAbsCellIdFromCellIndexes(imod+1, iphi, 0);
+    absIDs[3] = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta-1); 
+  } 
+  else if ( ieta == 0 && imod%2 ) 
+  {
+    absIDs[2] = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta+1);
+    absIDs[3] = geom-> GetAbsCellIdFromCellIndexes(imod-1, iphi, AliEMCALGeoParams::fgkEMCALCols-1); 
+  } 
+  else 
+  {
+    if ( ieta < AliEMCALGeoParams::fgkEMCALCols-1 ) 
+      absIDs[2] = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta+1);
+    if ( ieta > 0 )                                 
+      absIDs[3] = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1); 
+  }
+}
+
 ///
 /// For a given CaloCluster gets the absId of the cell 
 /// with maximum energy deposit.
@@ -1320,9 +1438,6 @@ void AliEMCALRecoUtils::GetMaxEnergyCell(const AliEMCALGeometry *geom,
   Float_t  recalFactor = 1.;
   Int_t    cellAbsId   = -1 ;
 
-  Int_t iTower  = -1;
-  Int_t iIphi   = -1;
-  Int_t iIeta   = -1;
   Int_t iSupMod0= -1;
 
   if (!clu) 
@@ -1339,8 +1454,7 @@ void AliEMCALRecoUtils::GetMaxEnergyCell(const AliEMCALGeometry *geom,
     //printf("a Cell %d, id, %d, amp %f, fraction %f\n",iDig,cellAbsId,cells->GetCellAmplitude(cellAbsId),fraction);
     if (fraction < 1e-4) fraction = 1.; // in case unfolding is off
     
-    geom->GetCellIndex(cellAbsId,iSupMod,iTower,iIphi,iIeta); 
-    geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi, iIeta,iphi,ieta);
+    GetCellIndexes(geom,cellAbsId,iSupMod,ieta,iphi);
     
     if (iDig==0) 
     {
@@ -1365,9 +1479,7 @@ void AliEMCALRecoUtils::GetMaxEnergyCell(const AliEMCALGeometry *geom,
   }// cell loop
   
   //Get from the absid the supermodule, tower and eta/phi numbers
-  geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta); 
-  //Gives SuperModule and Tower numbers
-  geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi, iIeta,iphi,ieta); 
+  GetCellIndexes(geom,absId,iSupMod,ieta,iphi);
   //printf("Max id %d, iSM %d, col %d, row %d\n",absId,iSupMod,ieta,iphi);
   //printf("Max end---\n");
 }
@@ -1563,6 +1675,8 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
   Bool_t oldStatus = TH1::AddDirectoryStatus();
   TH1::AddDirectory(kFALSE);
   
+  fCellCalibTableOK = kFALSE;
+  
   fEMCALBadChannelMap = new TObjArray(22);
   //TH2F * hTemp = new  TH2I("EMCALBadChannelMap","EMCAL SuperModule bad channel map", 48, 0, 48, 24, 0, 24);
   
@@ -1646,11 +1760,9 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
     if (!fCellsRecalibrated && IsRecalibrationOn()) 
     {
       // Energy  
-      Int_t iTower = -1, iIphi = -1, iIeta = -1; 
-      geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta); 
+      GetCellIndexes(geom,absId,imod,icol,irow); 
       if (fEMCALRecalibrationFactors->GetEntries() <= imod) 
         continue;
-      geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);      
       factor = GetEMCALChannelRecalibrationFactor(imod,icol,irow);
       
       AliDebug(2,Form("AliEMCALRecoUtils::RecalibrateClusterEnergy - recalibrate cell: module %d, col %d, row %d, cell fraction %f,recalibration factor %f, cell energy %f\n",
@@ -1708,6 +1820,15 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
     return;
   }  
   
+  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+  
+  // Use the calibration table if it is up to date
+  if ( fCellCalibTableOK && geom && geom == fCellCalibGeom ) 
+  {
+    RecalibrateCellsFromTable(geom, cells, bc);
+    return;
+  }
+  
   Short_t  absId  =-1;
   Bool_t   accept = kFALSE;
   Float_t  ecell  = 0;
@@ -1736,6 +1857,177 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
   fCellsRecalibrated = kTRUE;
 }
 
+///
+/// Copy the energy recalibration factors, time shifts and bad channel
+/// status of all cells into flat arrays indexed by cell absId, to be used by 
+/// RecalibrateCells() instead of the per super module histogram look-ups. 
+/// The table is reset when the maps are changed through the setters,
+/// and has to be filled again, e.g. at run change. Changes done directly on 
+/// the histograms of the maps are not seen, call ResetCellCalibrationTable() after them.
+///
+/// \param geom: AliEMCALGeometry pointer
+///
+/// \return bool, true if the table is available
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALRecoUtils::InitCellCalibrationTable(const AliEMCALGeometry *geom)
+{
+  fCellCalibTableOK = kFALSE;
+  
+  if (!geom) return kFALSE;
+  
+  Int_t nCells = geom->GetNCells();
+  if (nCells <= 0) return kFALSE;
+  
+  fCellCalibSM    .assign(nCells, -1);
+  fCellCalibStatus.assign(nCells, 0);
+  fCellCalibEnergy.assign(nCells, 1.);
+  fCellCalibTime  .assign(8*nCells, 0.);
+  
+  Int_t nSM = geom->GetNumberOfSuperModules();
+  
+  for (Int_t absId = 0; absId < nCells && absId < 24*48*nSM; absId++)
+  {
+    Int_t imod = -1, iphi =-1, ieta=-1, status=0;
+    if (!GetCellIndexes(geom,absId,imod,ieta,iphi)) continue;
+    
+    fCellCalibSM[absId] = imod;
+    
+    if (fEMCALBadChannelMap && fEMCALBadChannelMap->At(imod))
+    {
+      status = (Int_t) ((TH2I*)fEMCALBadChannelMap->At(imod))->GetBinContent(ieta,iphi); 
+      fCellCalibStatus[absId] = status;
+    }
+    
+    fCellCalibEnergy[absId] = GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    
+    if (!fEMCALTimeRecalibrationFactors) continue;
+    
+    for (Int_t ibc = 0; ibc < 8 && ibc < fEMCALTimeRecalibrationFactors->GetEntriesFast(); ibc++)
+    {
+      TH1F* h = (TH1F*) fEMCALTimeRecalibrationFactors->At(ibc);
+      if (h) fCellCalibTime[8*absId+ibc] = h->GetBinContent(absId);
+    }
+  }
+  
+  AliDebug(1,Form("Cell calibration table filled for %d cells",nCells));
+  
+  fCellCalibGeom    = geom;
+  fCellCalibTableOK = kTRUE;
+  
+  return kTRUE;
+}
+
+///
+/// Same as RecalibrateCells() but with the factors of the cell calibration table,
+/// see InitCellCalibrationTable(). The amplitude, time and gain are taken from the cell
+/// position in the list instead of being searched by absId.
+///
+/// \param geom: AliEMCALGeometry pointer
+/// \param cells: list of cells
+/// \param bc: bunch crossing number returned by esdevent->GetBunchCrossNumber()
+///
+//_____________________________________________________________________________
+void AliEMCALRecoUtils::RecalibrateCellsFromTable(const AliEMCALGeometry *geom, AliVCaloCells * cells, Int_t bc)
+{
+  Bool_t recalE  = !fCellsRecalibrated && IsRecalibrationOn();
+  Bool_t recalT  = !fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0;
+  Bool_t recalL1 = !fCellsRecalibrated && IsL1PhaseInTimeRecalibrationOn() && bc >= 0;
+  Bool_t badRm   = IsBadChannelsRemovalSwitchedOn();
+  Int_t  ibc     = bc >= 0 ? bc%4 : 0;
+  Int_t  nTable  = fCellCalibSM.size();
+  
+  // L1 phase shifts per super module for this bunch crossing, as in RecalibrateCellTimeL1Phase()
+  Double_t l1Offset[AliEMCALGeoParams::fgkEMCALModules];
+  Double_t l1Shift [AliEMCALGeoParams::fgkEMCALModules];
+  if ( recalL1 )
+  {
+    for (Int_t iSM = 0; iSM < AliEMCALGeoParams::fgkEMCALModules; iSM++)
+    {
+      Float_t offsetPerSM=0.;
+      Int_t l1PhaseShift = GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
+      Int_t l1Phase=l1PhaseShift & 3; //bit operation
+      
+      if(ibc >= l1Phase)
+        offsetPerSM = (ibc - l1Phase)*25;
+      else
+        offsetPerSM = (ibc - l1Phase + 4)*25;
+      
+      Int_t l1shiftOffset=l1PhaseShift>>2; //bit operation
+      l1shiftOffset*=25;
+      
+      l1Offset[iSM] = offsetPerSM*1.e-9;
+      l1Shift [iSM] = l1shiftOffset*1.e-9;
+    }
+  }
+  
+  Short_t  absId  =-1;
+  Float_t  ecell  = 0;
+  Double_t tcell  = 0;
+  Double_t ecellin = 0;
+  Double_t tcellin = 0;
+  Int_t  mclabel = -1;
+  Double_t efrac = 0;
+  
+  Int_t nEMcell  = cells->GetNumberOfCells() ;  
+  for (Int_t iCell = 0; iCell < nEMcell; iCell++) 
+  { 
+    cells->GetCell( iCell, absId, ecellin, tcellin, mclabel, efrac );
+    
+    Int_t imod = (absId >= 0 && absId < nTable) ? fCellCalibSM[absId] : -1;
+    
+    Bool_t accept = (imod >= 0);
+    
+    // Do not include bad channels found in analysis, 
+    // status selection and messages as in AcceptCalibrateCell()
+    if ( accept && badRm && fCellCalibStatus[absId] != AliCaloCalibPedestal::kAlive )
+    {
+      Int_t iphi = -1, ieta = -1, status = 0;
+      GetCellIndexes(geom,absId,imod,ieta,iphi);
+      Bool_t bad = GetEMCALChannelStatus(imod, ieta, iphi, status);
+      
+      if ( status > 0 )
+        AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absId, status, bad));
+      
+      if ( bad ) accept = kFALSE;
+    }
+    
+    if (!accept)
+    {
+      ecell = 0;
+      tcell = -1;
+    }
+    else 
+    {
+      //Recalibrate energy
+      ecell = ecellin;
+      if ( recalE ) ecell *= fCellCalibEnergy[absId];
+      
+      // Recalibrate time
+      tcell = tcellin;
+      tcell-=fConstantTimeShift*1e-9; // only in case of old Run1 simulation
+      
+      if ( recalT ) 
+      {
+        Bool_t isLowGain = fLowGain && !(cells->GetHighGain(iCell));
+        tcell -= fCellCalibTime[8*absId+ibc+4*isLowGain]*1.e-9;
+      }
+      
+      //Recalibrate time with L1 phase 
+      if ( recalL1 && imod < AliEMCALGeoParams::fgkEMCALModules )
+      {
+        tcell -= l1Offset[imod];
+        tcell -= l1Shift [imod];
+      }
+    }
+    
+    // Set new values
+    cells->SetCell(iCell,absId,ecell, tcell, mclabel, efrac);
+  }
+  
+  fCellsRecalibrated = kTRUE;
+}
+
 ///
 /// Recalibrate time of cell from AbsID number considering cell calibration map 
 ///
@@ -1937,7 +2229,6 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerGlobal(const AliEMCAL
   Float_t  recalFactor = 1.;
   
   Int_t    absId   = -1;
-  Int_t    iTower  = -1, iIphi  = -1, iIeta  = -1;
   Int_t    iSupModMax = -1, iSM=-1, iphi   = -1, ieta   = -1;
   Float_t  weight = 0.,  totalWeight=0.;
   Float_t  newPos[3] = {-1.,-1.,-1.};
@@ -1960,8 +2251,7 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerGlobal(const AliEMCAL
     
     if (!fCellsRecalibrated) 
     {
-      geom->GetCellIndex(absId,iSM,iTower,iIphi,iIeta); 
-      geom->GetCellPhiEtaIndexInSModule(iSM,iTower,iIphi, iIeta,iphi,ieta);      
+      GetCellIndexes(geom,absId,iSM,ieta,iphi);
       if (IsRecalibrationOn()) {
         recalFactor = GetEMCALChannelRecalibrationFactor(iSM,ieta,iphi);
       }
@@ -2024,8 +2314,6 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerIndex(const AliEMCALG
   Float_t  recalFactor = 1.;
   
   Int_t absId   = -1;
-  Int_t iTower  = -1;
-  Int_t iIphi   = -1, iIeta   = -1;
   Int_t iSupMod = -1, iSupModMax = -1;
   Int_t iphi = -1, ieta =-1;
   Bool_t shared = kFALSE;
@@ -2052,8 +2340,7 @@ void AliEMCALRecoUtils::RecalculateClusterPositionFromTowerIndex(const AliEMCALG
 
     eCell  = cells->GetCellAmplitude(absId);
     
-    geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta); 
-    geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi, iIeta,iphi,ieta);    
+    GetCellIndexes(geom,absId,iSupMod,ieta,iphi);
     
     if (!fCellsRecalibrated)
     {
@@ -2244,9 +2531,6 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
   Bool_t   isLowGain   = kFALSE;
 
   Int_t    iSupMod = -1;
-  Int_t    iTower  = -1;
-  Int_t    iIphi   = -1;
-  Int_t    iIeta   = -1;
   Int_t    iphi    = -1;
   Int_t    ieta    = -1;
   Double_t etai    = -1.;
@@ -2278,8 +2562,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     
     Int_t absId = cluster->GetCellAbsId(iDigit);
 
-    geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta);
-    geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi,iIeta, iphi,ieta);
+    GetCellIndexes(geom,absId,iSupMod,ieta,iphi);
     
     // Check if there are cells of different SM
     if      (iDigit == 0   ) iSM0 = iSupMod;
@@ -2314,8 +2597,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     // Get from the absid the supermodule, tower and eta/phi numbers
     Int_t absId = cluster->GetCellAbsId(iDigit);
 
-    geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta); 
-    geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi,iIeta, iphi,ieta);        
+    GetCellIndexes(geom,absId,iSupMod,ieta,iphi);
     
     //Get the cell energy, if recalibration is on, apply factors
     fraction  = cluster->GetCellAmplitudeFraction(iDigit);
@@ -2405,8 +2687,7 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
     // Get from the absid the supermodule, tower and eta/phi numbers
     Int_t absId = cluster->GetCellAbsId(iDigit);
 
-    geom->GetCellIndex(absId,iSupMod,iTower,iIphi,iIeta); 
-    geom->GetCellPhiEtaIndexInSModule(iSupMod,iTower,iIphi,iIeta, iphi,ieta);
+    GetCellIndexes(geom,absId,iSupMod,ieta,iphi);
     
     //Get the cell energy, if recalibration is on, apply factors
     fraction  = cluster->GetCellAmplitudeFraction(iDigit);
@@ -3571,6 +3852,7 @@ void AliEMCALRecoUtils::SetTracksMatchedToCluster(const AliVEvent *event)
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map) { 
+  fCellCalibTableOK = kFALSE;
   if(fEMCALRecalibrationFactors) fEMCALRecalibrationFactors->Clear();
   else {
     fEMCALRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3588,6 +3870,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH2F* h) { 
+  fCellCalibTableOK = kFALSE;
   if(!fEMCALRecalibrationFactors){
     fEMCALRecalibrationFactors = new TObjArray(iSM);
     fEMCALRecalibrationFactors->SetOwner(true);
@@ -3600,6 +3883,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) { 
+  fCellCalibTableOK = kFALSE;
   if(fEMCALBadChannelMap) fEMCALBadChannelMap->Clear();
   else {
     fEMCALBadChannelMap = new TObjArray(map->GetEntries());
@@ -3617,6 +3901,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) {
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
+  fCellCalibTableOK = kFALSE;
   if(!fEMCALBadChannelMap){
     fEMCALBadChannelMap = new TObjArray(iSM);
     fEMCALBadChannelMap->SetOwner(true);
@@ -3629,6 +3914,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map) { 
+  fCellCalibTableOK = kFALSE;
   if(fEMCALTimeRecalibrationFactors) fEMCALTimeRecalibrationFactors->Clear();
   else {
     fEMCALTimeRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3646,6 +3932,7 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const TH1F* h){ 
+  fCellCalibTableOK = kFALSE;
   if(!fEMCALTimeRecalibrationFactors){
     fEMCALTimeRecalibrationFactors = new TObjArray(bc);
     fEMCALTimeRecalibrationFactors->SetOwner(true);
@@ -40,6 +40,7 @@ class TArrayF;
 #include <TH2I.h>
 class TH2F;
 #include <TRandom3.h>
+#include <vector>
 
 // AliRoot includes
 class AliVCluster;
@@ -102,6 +103,8 @@ public:
   void     RecalculateClusterPositionFromTowerGlobal(const AliEMCALGeometry *geom, AliVCaloCells* cells, AliVCluster* clu); 
   
   Float_t  GetCellWeight(Float_t eCell, Float_t eCluster) const ;
+  Bool_t   InitCellIndexTable(const AliEMCALGeometry *geom);
+  Bool_t   GetCellIndexes(const AliEMCALGeometry *geom, Int_t absId, Int_t & iSupMod, Int_t & ieta, Int_t & iphi);
   void     GetMaxEnergyCell(const AliEMCALGeometry *geom, AliVCaloCells* cells, const AliVCluster* clu, 
                             Int_t & absId,  Int_t& iSupMod, Int_t& ieta, Int_t& iphi, Bool_t &shared);
   
@@ -158,6 +161,9 @@ public:
   Bool_t   AcceptCalibrateCell(Int_t absId, Int_t bc,
                                Float_t & amp, Double_t & time, AliVCaloCells* cells) ; // Energy and Time
   void     RecalibrateCells(AliVCaloCells * cells, Int_t bc) ; // Energy and Time
+  Bool_t   InitCellCalibrationTable(const AliEMCALGeometry *geom) ;
+  void     ResetCellCalibrationTable()                   { fCellCalibTableOK = kFALSE ; }
+  Bool_t   IsCellCalibrationTableOK()              const { return fCellCalibTableOK   ; }
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
 
@@ -177,6 +183,7 @@ public:
     else return 1 ; } 
   void     SetEMCALChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) { 
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors() ;
+    fCellCalibTableOK = kFALSE ;
     ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
   
   // Recalibrate channels energy with run dependent corrections
@@ -202,6 +209,7 @@ public:
     else return 0 ; } 
   void     SetEMCALChannelTimeRecalibrationFactor(Int_t bc, Int_t absID, Double_t c = 0, Bool_t isLGon=kFALSE) { 
     if(!fEMCALTimeRecalibrationFactors) InitEMCALTimeRecalibrationFactors() ;
+    fCellCalibTableOK = kFALSE ;
     ((TH1F*)fEMCALTimeRecalibrationFactors->At(bc+4*isLGon))->SetBinContent(absID,c) ; }  
   
   TH1F *   GetEMCALChannelTimeRecalibrationFactors(Int_t bc)const       { return (TH1F*)fEMCALTimeRecalibrationFactors->At(bc) ; }	
@@ -270,6 +278,7 @@ public:
   Bool_t   GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const ;
   void     SetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Double_t status = 1) { 
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap()               ;
+    fCellCalibTableOK = kFALSE                                              ;
     ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; }
   TH2I *   GetEMCALChannelStatusMap(Int_t iSM)     const { return (TH2I*)fEMCALBadChannelMap->At(iSM) ; }
   void     SetEMCALChannelStatusMap(const TObjArray *map);
@@ -548,8 +557,26 @@ private:
   TString    fMCGenerToAccept[5];        ///<  List with name of generators that should not be included
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
+  void       GetCrossCells(const AliEMCALGeometry *geom, Int_t imod, Int_t iphi, Int_t ieta, Int_t *absIDs) const;
+  void       RecalibrateCellsFromTable(const AliEMCALGeometry *geom, AliVCaloCells * cells, Int_t bc);
+  
+  // Cell index table, built once per geometry
+  const AliEMCALGeometry *fCellIndexGeom; //!<! Geometry the cell index table was built for
+  std::vector<Short_t> fCellIndexSM;     //!<! Super module of each cell absId, -1 if not valid
+  std::vector<Short_t> fCellIndexEta;    //!<! Column (eta index) in super module of each cell absId
+  std::vector<Short_t> fCellIndexPhi;    //!<! Row (phi index) in super module of each cell absId
+  std::vector<Int_t>   fCellCross;       //!<! 4 cross neighbours of each cell absId as used in GetECross(), -1 if none
+  
+  // Cell calibration table, copy of the calibration maps indexed by cell absId, see InitCellCalibrationTable()
+  Bool_t     fCellCalibTableOK;                //!<! Calibration table is filled and the maps did not change since
+  const AliEMCALGeometry *fCellCalibGeom;      //!<! Geometry the calibration table was built for
+  std::vector<Short_t> fCellCalibSM;           //!<! Super module of each cell absId, -1 if not valid
+  std::vector<Short_t> fCellCalibStatus;       //!<! Bad channel map status of each cell absId
+  std::vector<Float_t> fCellCalibEnergy;       //!<! Energy recalibration factor of each cell absId
+  std::vector<Float_t> fCellCalibTime;         //!<! Time shifts of each cell absId, 4 bunch crossings for high gain then 4 for low gain
+  
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 26) ;
+  ClassDef(AliEMCALRecoUtils, 28) ;
   /// \endcond
 
 };
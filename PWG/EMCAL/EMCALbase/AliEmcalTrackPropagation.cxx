@@ -0,0 +1,111 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <AliAnalysisManager.h>
+#include <AliVEvent.h>
+#include <AliVTrack.h>
+
+#include "AliEMCALRecoUtils.h"
+#include "AliEmcalTrackPropagation.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalTrackPropagation)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+AliEmcalTrackPropagation *AliEmcalTrackPropagation::fgInstance = nullptr;
+
+AliEmcalTrackPropagation::AliEmcalTrackPropagation() :
+  TObject(),
+  fEvent(nullptr),
+  fEntry(-1),
+  fSettings(),
+  fRecords(),
+  fNPropagated(0),
+  fNReused(0)
+{
+
+}
+
+AliEmcalTrackPropagation *AliEmcalTrackPropagation::Instance() {
+  if(!fgInstance) fgInstance = new AliEmcalTrackPropagation;
+  return fgInstance;
+}
+
+void AliEmcalTrackPropagation::StartEvent(const AliVEvent *event) {
+  // The event object is reused by the input handler, the entry in the
+  // chain is needed to tell two events apart
+  Long64_t entry = -1;
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if(mgr) entry = mgr->GetCurrentEntry();
+  if(event == fEvent && entry == fEntry && entry >= 0) return;
+  fRecords.clear();
+  fEvent = event;
+  fEntry = entry;
+}
+
+Int_t AliEmcalTrackPropagation::GetSettingsIndex(Double_t dist, Double_t mass, Double_t step, Double_t minpt, Bool_t useMassForTracking, Bool_t useDCA) {
+  for(std::vector<Settings_t>::size_type i = 0; i < fSettings.size(); i++) {
+    const Settings_t &s = fSettings[i];
+    if(s.fDist == dist && s.fMass == mass && s.fStep == step && s.fMinPt == minpt &&
+       s.fUseMassForTracking == useMassForTracking && s.fUseDCA == useDCA) return i;
+  }
+  Settings_t s = {dist, mass, step, minpt, useMassForTracking, useDCA};
+  fSettings.push_back(s);
+  return fSettings.size() - 1;
+}
+
+Int_t AliEmcalTrackPropagation::PropagateTracks(const AliVEvent *event, const std::vector<AliVTrack *> &tracks, Double_t dist, Double_t mass,
+                                                Double_t step, Double_t minpt, Bool_t useMassForTracking, Bool_t useDCA) {
+  StartEvent(event);
+  Int_t settings = GetSettingsIndex(dist, mass, step, minpt, useMassForTracking, useDCA);
+  Int_t npropagated = 0;
+  for(std::vector<AliVTrack *>::const_iterator it = tracks.begin(); it != tracks.end(); ++it) {
+    AliVTrack *track = *it;
+    if(!track) continue;
+    std::map<const AliVTrack *, Record_t>::iterator found = fRecords.find(track);
+    if(found != fRecords.end()) {
+      const Record_t &rec = found->second;
+      // values on the track still the ones from the propagation with these settings
+      if(rec.fSettings == settings && rec.fEta == track->GetTrackEtaOnEMCal() &&
+         rec.fPhi == track->GetTrackPhiOnEMCal() && rec.fPt == track->GetTrackPtOnEMCal()) {
+        fNReused++;
+        continue;
+      }
+    }
+    AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, dist, mass, step, minpt, useMassForTracking, useDCA);
+    Record_t rec = {settings, track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), track->GetTrackPtOnEMCal()};
+    fRecords[track] = rec;
+    fNPropagated++;
+    npropagated++;
+  }
+  return npropagated;
+}
+
+void AliEmcalTrackPropagation::Print(Option_t *) const {
+  Printf("AliEmcalTrackPropagation: %lld tracks propagated, %lld propagations reused", fNPropagated, fNReused);
+}
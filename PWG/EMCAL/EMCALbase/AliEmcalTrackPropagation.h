@@ -0,0 +1,138 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALTRACKPROPAGATION_H
+#define ALIEMCALTRACKPROPAGATION_H
+
+#include <map>
+#include <vector>
+#include <TObject.h>
+
+class AliVEvent;
+class AliVTrack;
+
+namespace PWG {
+
+namespace EMCAL {
+
+/**
+ * @class AliEmcalTrackPropagation
+ * @brief Batched propagation of tracks to the EMCal surface, shared by all tasks of a train
+ * @ingroup EMCALCOREFW
+ *
+ * Tasks which need the track position on the EMCal surface (AliEmcalTrackPropagatorTask,
+ * the cluster-track matcher of the correction framework, ...) hand over the tracks of the
+ * event as one batch. Each track is propagated with AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface
+ * and the resulting eta/phi/pt are stored on the track, as usual. The object keeps track
+ * of the tracks which were already propagated in the current event and with which settings,
+ * so a track shared between containers or tasks is propagated only once; downstream
+ * tasks reuse the values stored on the track.
+ *
+ * A track is propagated again if the settings differ or if its values on the EMCal
+ * surface were changed in the meanwhile by somebody else, so the results are the
+ * same as with the track-by-track propagation.
+ */
+class AliEmcalTrackPropagation : public TObject {
+public:
+
+  /**
+   * @brief Access to the instance shared by all tasks
+   * @return The shared object
+   */
+  static AliEmcalTrackPropagation *Instance();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalTrackPropagation() {}
+
+  /**
+   * @brief Propagate a batch of tracks to the EMCal surface
+   *
+   * Arguments as in AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface.
+   * @param event Event the tracks belong to
+   * @param tracks Tracks to be propagated
+   * @return Number of tracks which had to be propagated (not yet done in this event)
+   */
+  Int_t PropagateTracks(const AliVEvent *event, const std::vector<AliVTrack *> &tracks, Double_t dist = 440., Double_t mass = 0.1396,
+                        Double_t step = 20., Double_t minpt = 0.35, Bool_t useMassForTracking = kFALSE, Bool_t useDCA = kFALSE);
+
+  /**
+   * @brief Print the number of propagations done and saved
+   * @param opt Not used
+   */
+  virtual void Print(Option_t *opt = "") const;
+
+private:
+  /**
+   * @struct Settings_t
+   * @brief Propagation settings
+   */
+  struct Settings_t {
+    Double_t fDist;                 ///< distance to the surface
+    Double_t fMass;                 ///< mass hypothesis
+    Double_t fStep;                 ///< propagation step
+    Double_t fMinPt;                ///< min. pt
+    Bool_t   fUseMassForTracking;   ///< use mass for tracking
+    Bool_t   fUseDCA;               ///< start from DCA
+  };
+
+  /**
+   * @struct Record_t
+   * @brief Result of the propagation of a track in the current event
+   */
+  struct Record_t {
+    Int_t    fSettings;             ///< index of the settings
+    Double_t fEta;                  ///< eta on the EMCal surface
+    Double_t fPhi;                  ///< phi on the EMCal surface
+    Double_t fPt;                   ///< pt on the EMCal surface
+  };
+
+  AliEmcalTrackPropagation();
+  AliEmcalTrackPropagation(const AliEmcalTrackPropagation &);
+  AliEmcalTrackPropagation &operator=(const AliEmcalTrackPropagation &);
+
+  void  StartEvent(const AliVEvent *event);
+  Int_t GetSettingsIndex(Double_t dist, Double_t mass, Double_t step, Double_t minpt, Bool_t useMassForTracking, Bool_t useDCA);
+
+  static AliEmcalTrackPropagation           *fgInstance;    //!<! Shared instance
+
+  const AliVEvent                           *fEvent;        //!<! Event the records refer to
+  Long64_t                                   fEntry;        //!<! Entry of the event in the input chain
+  std::vector<Settings_t>                    fSettings;     //!<! Settings in use
+  std::map<const AliVTrack *, Record_t>      fRecords;      //!<! Tracks propagated in the current event
+  Long64_t                                   fNPropagated;  //!<! Number of propagations done
+  Long64_t                                   fNReused;      //!<! Number of propagations saved
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTrackPropagation, 1);
+  /// \endcond
+};
+
+}
+}
+
+#endif
@@ -39,6 +39,7 @@
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultUserStorage+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultCombined+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultHybrid+;
+#pragma link C++ class PWG::EMCAL::AliEmcalTrackPropagation+;
 #pragma link C++ class PWG::EMCAL::AliEmcalAODFilterBitCuts+;
 #pragma link C++ class PWG::EMCAL::AliEmcalCutBase+;
 #pragma link C++ class PWG::EMCAL::AliEmcalVCutsWrapper+;
@@ -9,6 +9,7 @@
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEmcalTrackPropagation.h"
 #include "AliESDCaloCluster.h"
 #include "AliAODCaloCluster.h"
 #include "AliVParticle.h"
@@ -35,10 +36,12 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fMaxDistance(0.1),
   fUsePIDmass(kTRUE),
   fUseDCA(kTRUE),
+  fBatchPropagation(kFALSE),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
+  fTracksToPropagate(),
   fEmcalTracks(0),
   fEmcalClusters(0),
   fNEmcalTracks(0),
@@ -77,6 +80,7 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Initialize()
   
   GetProperty("usePIDmass", fUsePIDmass);
   GetProperty("useDCA", fUseDCA);
+  GetProperty("batchPropagation", fBatchPropagation);
   GetProperty("maxDist", fMaxDistance);
   GetProperty("updateClusters", fUpdateClusters);
   GetProperty("updateTracks", fUpdateTracks);
@@ -290,6 +294,7 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
     mass = 0.1396;
   }
 
+  fTracksToPropagate.clear();
   AliParticleContainer * partCont = 0;
   TIter nextPartCont(&fParticleCollArray);
   while ((partCont = static_cast<AliParticleContainer*>(nextPartCont()))) {
@@ -332,8 +337,9 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
           if ( !generOK ) continue;
         }
         
-        // Propagate the track
-        AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA);
+        // Propagate the track (in batch mode after the loop, the AliEmcalParticle does not depend on it)
+        if (fBatchPropagation) fTracksToPropagate.push_back(track);
+        else AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA);
       }
 
       // Reset properties of the track to fix TRefArray errors which occur when AddTrackMatched(obj) is called.
@@ -359,6 +365,12 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
       fNEmcalTracks++;
     }
   }
+
+  // Tracks already propagated with the same settings in this event (by another
+  // container or task) are not propagated again
+  if (fBatchPropagation) {
+    PWG::EMCAL::AliEmcalTrackPropagation::Instance()->PropagateTracks(fEventManager.InputEvent(), fTracksToPropagate, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA);
+  }
 }
 
 /**
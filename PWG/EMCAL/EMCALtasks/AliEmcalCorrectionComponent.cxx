@@ -204,8 +204,13 @@ void AliEmcalCorrectionComponent::UpdateCells()
   
   Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
   
-  if (fRecoUtils)
+  if (fRecoUtils) {
+    // refill the flat cell calibration table if the calibration maps changed, e.g. at run change
+    if (!fRecoUtils->IsCellCalibrationTableOK())
+      fRecoUtils->InitCellCalibrationTable(fGeom);
+    
     fRecoUtils->RecalibrateCells(fCaloCells, bunchCrossNo);
+  }
   
   fCaloCells->Sort();
 }
@@ -222,6 +227,10 @@ Bool_t AliEmcalCorrectionComponent::CheckIfRunChanged()
     fRun = fEventManager.InputEvent()->GetRunNumber();
     AliWarning(Form("Run changed, initializing parameters for %d", fRun));
     
+    // calibration maps are reloaded by the components, the cell calibration table has to be refilled
+    if (fRecoUtils)
+      fRecoUtils->ResetCellCalibrationTable();
+    
     // init geometry if not already done
     fGeom = AliEMCALGeometry::GetInstanceFromRunNumber(fRun);
     if (!fGeom)
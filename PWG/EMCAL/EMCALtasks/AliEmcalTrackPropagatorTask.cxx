@@ -11,6 +11,7 @@
 
 #include <AliVTrack.h>
 #include <AliEMCALRecoUtils.h>
+#include "AliEmcalTrackPropagation.h"
 
 ClassImp(AliEmcalTrackPropagatorTask)
 
@@ -19,7 +20,9 @@ AliEmcalTrackPropagatorTask::AliEmcalTrackPropagatorTask() :
   AliAnalysisTaskEmcal("AliEmcalTrackPropagatorTask", kFALSE),
   fDist(440),
   fOnlyIfNotSet(kTRUE),
-  fOnlyIfEmcal(kTRUE)
+  fOnlyIfEmcal(kTRUE),
+  fBatchPropagation(kFALSE),
+  fTracksToPropagate()
 {
   // Constructor.
 }
@@ -29,7 +32,9 @@ AliEmcalTrackPropagatorTask::AliEmcalTrackPropagatorTask(const char *name) :
   AliAnalysisTaskEmcal(name, kFALSE),
   fDist(440),
   fOnlyIfNotSet(kTRUE),
-  fOnlyIfEmcal(kTRUE)
+  fOnlyIfEmcal(kTRUE),
+  fBatchPropagation(kFALSE),
+  fTracksToPropagate()
 {
   // Constructor.
 }
@@ -62,14 +67,19 @@ Bool_t AliEmcalTrackPropagatorTask::Run()
 
   if (!tracks) return 0;
   
+  fTracksToPropagate.clear();
   tracks->ResetCurrentID();
   AliVTrack* track = 0;
   while ((track = static_cast<AliVTrack*>(tracks->GetNextAcceptParticle()))) {
     if (fOnlyIfNotSet && track->IsExtrapolatedToEMCAL()) continue;
     if (fOnlyIfEmcal && !track->IsEMCAL()) continue;
     
-    AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fDist);
+    if (fBatchPropagation) fTracksToPropagate.push_back(track);
+    else AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fDist);
   }
 
+  if (fBatchPropagation) 
+    PWG::EMCAL::AliEmcalTrackPropagation::Instance()->PropagateTracks(InputEvent(), fTracksToPropagate, fDist);
+
   return kTRUE;
 }
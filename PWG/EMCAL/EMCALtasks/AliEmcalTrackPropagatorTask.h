@@ -1,8 +1,12 @@
 #ifndef ALIEMCALTRACKPROPAGATORTASK_H
 #define ALIEMCALTRACKPROPAGATORTASK_H
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcal.h"
 
+class AliVTrack;
+
 class AliEmcalTrackPropagatorTask : public AliAnalysisTaskEmcal {
  public:
   AliEmcalTrackPropagatorTask();
@@ -12,6 +16,7 @@ class AliEmcalTrackPropagatorTask : public AliAnalysisTaskEmcal {
   void               SetDist(Double_t d)               { fDist           = d; }
   void               SetOnlyIfNotSet(Bool_t b)         { fOnlyIfNotSet   = b; }
   void               SetOnlyIfEmcal(Bool_t b)          { fOnlyIfEmcal    = b; }
+  void               SetBatchPropagation(Bool_t b)     { fBatchPropagation = b; }
 
  protected:
   void               ExecOnce();
@@ -20,11 +25,13 @@ class AliEmcalTrackPropagatorTask : public AliAnalysisTaskEmcal {
   Double_t           fDist;              // distance to surface (440cm default)
   Bool_t             fOnlyIfNotSet;      // propagate only if needed
   Bool_t             fOnlyIfEmcal;       // propagate only if it is in the EMCal acceptance
+  Bool_t             fBatchPropagation;  // propagate through the shared AliEmcalTrackPropagation (once per track and event)
+  std::vector<AliVTrack*> fTracksToPropagate; //!tracks to be propagated in the current event
 
  private:
   AliEmcalTrackPropagatorTask(const AliEmcalTrackPropagatorTask&);            // not implemented
   AliEmcalTrackPropagatorTask &operator=(const AliEmcalTrackPropagatorTask&); // not implemented
 
-  ClassDef(AliEmcalTrackPropagatorTask, 3); // Class to propagate and store track parameters at EMCAL surface
+  ClassDef(AliEmcalTrackPropagatorTask, 4); // Class to propagate and store track parameters at EMCAL surface
 };
 #endif
@@ -334,6 +334,15 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
+  FillBin(bin, istep, weight);
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBin(Long64_t bin, Int_t istep, Double_t weight)
+{
+  // fills an entry into the global bin <bin> (bins start from 0, no under/overflow)
+  // for callers which compute the bin indices themselves, e.g. once per particle instead of once per pair
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -355,9 +364,6 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
     fSumw2[istep]->GetArray()[bin] += weight * weight;
   
 //   Printf("%f", fValues[istep][bin]);
-  
-  // debug
-//   AliCFContainer::Fill(var, istep, weight);
 }
 
 template <class TemplateArray, typename TemplateType>
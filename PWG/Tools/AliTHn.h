@@ -48,6 +48,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  void FillBin(Long64_t bin, Int_t istep, Double_t weight=1.);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -30,6 +30,7 @@
 #include <TObjArray.h>
 #include <TObjString.h>
 #include <TProfile.h>
+#include <TStopwatch.h>
 #include <TString.h>
 
 #include "TBinning.h"
@@ -409,17 +410,10 @@ void THistManager::SetObject(TObject * const o, const char *group) {
 }
 
 void THistManager::FillTH1(const char *name, double x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTH1(ResolveTH1(name), x, weight, opt);
+}
+
+void THistManager::FillTH1(TH1 *hist, double x, double weight, Option_t *opt) {
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
 	  // use bin width as weight
@@ -432,17 +426,10 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 }
 
 void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent){
-    Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
-    return;
-  }
-  TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
-  if(!hist){
-    Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-    return;
-  }
+  FillTH1(ResolveTH1(name), label, weight, opt);
+}
+
+void THistManager::FillTH1(TH1 *hist, const char *label, double weight, Option_t *opt) {
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
 	  // use bin width as weight
@@ -456,17 +443,10 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
 }
 
 void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTH2(ResolveTH2(name), x, y, weight, opt);
+}
+
+void THistManager::FillTH2(TH2 *hist, double x, double y, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -481,17 +461,10 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 }
 
 void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTH2(ResolveTH2(name), point, weight, opt);
+}
+
+void THistManager::FillTH2(TH2 *hist, double *point, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -506,17 +479,10 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 }
 
 void THistManager::FillTH2(const char *name, const char *labelX, const char *labelY, double weight, Option_t *opt) {
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent){
-    Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-    return;
-  }
-  TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
-  if(!hist){
-    Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-    return;
-  }
+  FillTH2(ResolveTH2(name), labelX, labelY, weight, opt);
+}
+
+void THistManager::FillTH2(TH2 *hist, const char *labelX, const char *labelY, double weight, Option_t *opt) {
   TString optstring(opt);
   Double_t myweight = optstring.Contains("w") ? 1. : weight;
   if(optstring.Contains("wx")){
@@ -531,17 +497,10 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
 }
 
 void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTH3(ResolveTH3(name), x, y, z, weight, opt);
+}
+
+void THistManager::FillTH3(TH3 *hist, double x, double y, double z, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -560,17 +519,10 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 }
 
 void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTH3(ResolveTH3(name), point, weight, opt);
+}
+
+void THistManager::FillTH3(TH3 *hist, const double* point, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -589,17 +541,10 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 }
 
 void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
-	if(!hist){
-		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
-		return;
-	}
+  FillTHnSparse(ResolveTHnSparse(name), x, weight, opt);
+}
+
+void THistManager::FillTHnSparse(THnSparse *hist, const double *x, double weight, Option_t *opt) {
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
@@ -614,17 +559,44 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 	hist->Fill(x, weight);
 }
 
-void THistManager::FillProfile(const char* name, double x, double y, double weight){
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent)
-		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
-  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
-  if(!hist)
-		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+void THistManager::FillProfile(const char* name, double x, double y, double weight) {
+  FillProfile(ResolveTProfile(name), x, y, weight);
+}
+
+void THistManager::FillProfile(TProfile *hist, double x, double y, double weight) {
   hist->Fill(x, y, weight);
 }
 
+TH1 *THistManager::ResolveTH1(const char *name) const {
+  TH1 *hist = dynamic_cast<TH1 *>(ResolveObject(name, "THistManager::ResolveTH1"));
+  if(!hist) Fatal("THistManager::ResolveTH1", "Object %s is not a TH1", name);
+  return hist;
+}
+
+TH2 *THistManager::ResolveTH2(const char *name) const {
+  TH2 *hist = dynamic_cast<TH2 *>(ResolveObject(name, "THistManager::ResolveTH2"));
+  if(!hist) Fatal("THistManager::ResolveTH2", "Object %s is not a TH2", name);
+  return hist;
+}
+
+TH3 *THistManager::ResolveTH3(const char *name) const {
+  TH3 *hist = dynamic_cast<TH3 *>(ResolveObject(name, "THistManager::ResolveTH3"));
+  if(!hist) Fatal("THistManager::ResolveTH3", "Object %s is not a TH3", name);
+  return hist;
+}
+
+THnSparse *THistManager::ResolveTHnSparse(const char *name) const {
+  THnSparse *hist = dynamic_cast<THnSparse *>(ResolveObject(name, "THistManager::ResolveTHnSparse"));
+  if(!hist) Fatal("THistManager::ResolveTHnSparse", "Object %s is not a THnSparse", name);
+  return hist;
+}
+
+TProfile *THistManager::ResolveTProfile(const char *name) const {
+  TProfile *hist = dynamic_cast<TProfile *>(ResolveObject(name, "THistManager::ResolveTProfile"));
+  if(!hist) Fatal("THistManager::ResolveTProfile", "Object %s is not a TProfile", name);
+  return hist;
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -647,6 +619,21 @@ THashList *THistManager::FindGroup(const char *dirname) const {
 	return nullptr;
 }
 
+TObject *THistManager::ResolveObject(const char *name, const char *method) const {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal(method, "Parent group %s does not exist", dirname.Data());
+		return NULL;
+	}
+	TObject *obj = parent->FindObject(hname);
+	if(!obj){
+		Fatal(method, "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return NULL;
+	}
+	return obj;
+}
+
 TString THistManager::basename(const TString &path) const {
 	int index = path.Last('/');
 	if(index < 0) return "";  // no directory structure
@@ -1030,6 +1017,90 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(int nfill){
+    // Same layout in both managers: per trigger class pt spectrum, eta-phi map and THnSparse
+    // (as in the EMCal track and cluster QA tasks)
+    const int kNtrigger = 5;
+    const char *triggers[kNtrigger] = {"INT7", "EMC7", "EJ1", "EJ2", "EG1"};
+    THistManager bynamemgr("bynamemgr"), byhandlemgr("byhandlemgr");
+    THistManager *managers[2] = {&bynamemgr, &byhandlemgr};
+    int nbins[4] = {100, 20, 36, 10}; double min[4] = {0., -1., 0., 0.}, max[4] = {100., 1., 6.3, 100.};
+    for(int imgr = 0; imgr < 2; imgr++){
+      for(int itrg = 0; itrg < kNtrigger; itrg++){
+        managers[imgr]->CreateTH1(Form("%s/hPt", triggers[itrg]), "pt", 100, 0., 100.);
+        managers[imgr]->CreateTH2(Form("%s/hEtaPhi", triggers[itrg]), "eta-phi", 20, -1., 1., 36, 0., 6.3);
+        managers[imgr]->CreateTHnSparse(Form("%s/hSparse", triggers[itrg]), "sparse", 4, nbins, min, max);
+      }
+    }
+
+    // handles resolved once, as it would be done in UserCreateOutputObjects
+    TH1 *hpt[kNtrigger]; TH2 *hetaphi[kNtrigger]; THnSparse *hsparse[kNtrigger];
+    for(int itrg = 0; itrg < kNtrigger; itrg++){
+      hpt[itrg] = byhandlemgr.ResolveTH1(Form("%s/hPt", triggers[itrg]));
+      hetaphi[itrg] = byhandlemgr.ResolveTH2(Form("%s/hEtaPhi", triggers[itrg]));
+      hsparse[itrg] = byhandlemgr.ResolveTHnSparse(Form("%s/hSparse", triggers[itrg]));
+    }
+
+    std::vector<std::string> ptnames, etaphinames, sparsenames;
+    for(int itrg = 0; itrg < kNtrigger; itrg++){
+      ptnames.push_back(Form("%s/hPt", triggers[itrg]));
+      etaphinames.push_back(Form("%s/hEtaPhi", triggers[itrg]));
+      sparsenames.push_back(Form("%s/hSparse", triggers[itrg]));
+    }
+
+    TStopwatch timer;
+    timer.Start();
+    for(int i = 0; i < nfill; i++){
+      double point[4] = {(i % 1000) * 0.1, -1. + (i % 200) * 0.01, (i % 630) * 0.01, (i % 97) * 1.};
+      for(int itrg = 0; itrg < kNtrigger; itrg++){
+        bynamemgr.FillTH1(ptnames[itrg].c_str(), point[0]);
+        bynamemgr.FillTH2(etaphinames[itrg].c_str(), point[1], point[2]);
+        bynamemgr.FillTHnSparse(sparsenames[itrg].c_str(), point);
+      }
+    }
+    timer.Stop();
+    double timebyname = timer.CpuTime();
+
+    timer.Start(kTRUE);
+    for(int i = 0; i < nfill; i++){
+      double point[4] = {(i % 1000) * 0.1, -1. + (i % 200) * 0.01, (i % 630) * 0.01, (i % 97) * 1.};
+      for(int itrg = 0; itrg < kNtrigger; itrg++){
+        byhandlemgr.FillTH1(hpt[itrg], point[0]);
+        byhandlemgr.FillTH2(hetaphi[itrg], point[1], point[2]);
+        byhandlemgr.FillTHnSparse(hsparse[itrg], point);
+      }
+    }
+    timer.Stop();
+    double timebyhandle = timer.CpuTime();
+    std::cout << "Fill " << nfill * kNtrigger * 3 << " entries: by name " << timebyname << " s, by handle " << timebyhandle << " s" << std::endl;
+
+    // Evaluate test
+    bool success(true);
+    for(int itrg = 0; itrg < kNtrigger; itrg++){
+      TH1 *refpt = static_cast<TH1 *>(bynamemgr.FindObject(ptnames[itrg].c_str()));
+      TH2 *refetaphi = static_cast<TH2 *>(bynamemgr.FindObject(etaphinames[itrg].c_str()));
+      THnSparse *refsparse = static_cast<THnSparse *>(bynamemgr.FindObject(sparsenames[itrg].c_str()));
+      for(int ib = 0; ib <= hpt[itrg]->GetNbinsX() + 1; ib++){
+        if(TMath::Abs(refpt->GetBinContent(ib) - hpt[itrg]->GetBinContent(ib)) > DBL_EPSILON){
+          std::cout << ptnames[itrg] << ": Value mismatch in bin " << ib << std::endl;
+          success = false;
+          break;
+        }
+      }
+      if(TMath::Abs(refetaphi->GetSumOfWeights() - hetaphi[itrg]->GetSumOfWeights()) > DBL_EPSILON
+          || refetaphi->GetMaximumBin() != hetaphi[itrg]->GetMaximumBin()){
+        std::cout << etaphinames[itrg] << ": Content mismatch" << std::endl;
+        success = false;
+      }
+      if(refsparse->GetNbins() != hsparse[itrg]->GetNbins()
+          || TMath::Abs(refsparse->GetEntries() - hsparse[itrg]->GetEntries()) > DBL_EPSILON){
+        std::cout << sparsenames[itrg] << ": Content mismatch" << std::endl;
+        success = false;
+      }
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1121,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms(1000);
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1147,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(int nfill){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms(nfill);
+  }
 }
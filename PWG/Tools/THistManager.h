@@ -634,6 +634,143 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Resolve a 1D histogram within the container.
+   *
+   * The path lookup (group traversal and hash lookup) is done only once
+   * here. The returned handle is meant to be resolved in UserCreateOutputObjects
+   * and then used in the Fill methods taking a histogram pointer in the event loop.
+   * The histogram name also contains the parent group(s) according to the common
+   * group notation.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (fatal if not found or of different type)
+   */
+  TH1 *ResolveTH1(const char *name) const;
+
+  /**
+   * @brief Resolve a 2D histogram within the container.
+   *
+   * See @ref ResolveTH1 for details.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (fatal if not found or of different type)
+   */
+  TH2 *ResolveTH2(const char *name) const;
+
+  /**
+   * @brief Resolve a 3D histogram within the container.
+   *
+   * See @ref ResolveTH1 for details.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (fatal if not found or of different type)
+   */
+  TH3 *ResolveTH3(const char *name) const;
+
+  /**
+   * @brief Resolve a THnSparse within the container.
+   *
+   * See @ref ResolveTH1 for details.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (fatal if not found or of different type)
+   */
+  THnSparse *ResolveTHnSparse(const char *name) const;
+
+  /**
+   * @brief Resolve a profile histogram within the container.
+   *
+   * See @ref ResolveTH1 for details.
+   * @param[in] name Name of the profile histogram
+   * @return Handle to the histogram (fatal if not found or of different type)
+   */
+  TProfile *ResolveTProfile(const char *name) const;
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   *
+   * Same as the corresponding Fill method by name, without
+   * the lookup of the histogram.
+   * @param[in] hist Handle obtained from @ref ResolveTH1
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(TH1 *hist, double x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 1D histogram via its handle using a bin label.
+   * @param[in] hist Handle obtained from @ref ResolveTH1
+   * @param[in] label Label of the bin to fill
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(TH1 *hist, const char *label, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTH2
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, double x, double y, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle using bin labels.
+   * @param[in] hist Handle obtained from @ref ResolveTH2
+   * @param[in] labelX x-coordinate
+   * @param[in] labelY y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, const char *labelX, const char *labelY, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTH2
+   * @param[in] point coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2 *hist, double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTH3
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(TH3 *hist, double x, double y, double z, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTH3
+   * @param[in] point 3D-coordinate (x,y,z) of the point to be filled
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(TH3 *hist, const double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a nD histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTHnSparse
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTHnSparse(THnSparse *hist, const double *x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   * @param[in] hist Handle obtained from @ref ResolveTProfile
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(TProfile *hist, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -705,6 +842,16 @@ private:
 	 */
 	THashList *FindGroup(const char *dirname) const;
 
+	/**
+	 * @brief Find an object in the container, fatal if it does not exist.
+	 *
+	 * Used by the Resolve and the Fill methods by name.
+	 * @param[in] name Path of the object
+	 * @param[in] method Name of the caller, used in the error message
+	 * @return Object found
+	 */
+	TObject *ResolveObject(const char *name, const char *method) const;
+
 	/**
 	 * @brief Extracting the basename from a given histogram path.
 	 * @param[in] path histogram path
@@ -845,6 +992,23 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether filling via resolved handles gives the same
+   * result as filling by name, and compare the time spent in both
+   * Relies on: TestFillGroupedHistograms
+   *
+   * Creating a setup similar to the EMCal track and cluster QA tasks: for a number of
+   * trigger classes a group with a 1D pt spectrum, a 2D eta-phi map and a 4D THnSparse.
+   * Each histogram is filled nfill times via the name and, in a second manager, via
+   * handles resolved before the loop. Times of both loops are printed.
+   *
+   * Test passed:
+   * - Histograms filled by name and via handles have the same content
+   * @param[in] nfill Number of fills per histogram
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms(int nfill);
 };
 
 /**
@@ -882,5 +1046,14 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles, including the timing
+ * comparison with filling by name. See @ref THistManagerTestSuite
+ * for details.
+ * @param[in] nfill Number of fills per histogram
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle(int nfill = 100000);
+
 }
 #endif
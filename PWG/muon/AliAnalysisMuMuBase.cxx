@@ -69,9 +69,18 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fPathKeys(),
+fPathKeyNames(),
+fHistoKeys(),
+fHistoKeyNames(),
+fHistoKeyDisabled(),
+fObjectTable(),
+fLastPath(8),
+fLastPathKey()
 {
  /// default ctor
+  fLastPathKey[0] = fLastPathKey[1] = -1;
 }
 
 //_____________________________________________________________________________
@@ -407,6 +416,20 @@ void AliAnalysisMuMuBase::DisableHistograms(const char* pattern)
   }
 
   fHistogramToDisable->Add(new TObjString(spattern));
+
+  fHistoKeyDisabled.assign(fHistoKeyDisabled.size(),-1);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuBase::ClearObjectTable()
+{
+  /// Forget the objects resolved for the (path key, histogram key) pairs.
+  /// The keys themselves stay valid.
+
+  for ( std::vector<std::vector<TObject*> >::size_type i = 0; i < fObjectTable.size(); ++i )
+  {
+    fObjectTable[i].clear();
+  }
 }
 
 //_____________________________________________________________________________
@@ -518,6 +541,7 @@ void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
   fHistogramCollection = &hc;
   fBinning             = &binning;
   fCutRegistry         = &registry;
+  ClearObjectTable();
 }
 
 //_____________________________________________________________________________
@@ -544,6 +568,19 @@ Bool_t AliAnalysisMuMuBase::IsHistogramDisabled(const char* hname) const
   return kFALSE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuBase::IsHistoKeyDisabled(Int_t histoKey)
+{
+  /// Same as IsHistogramDisabled(const char*) for an interned histogram name,
+  /// the regexp matching being done only once per name
+
+  if ( fHistoKeyDisabled[histoKey] < 0 )
+  {
+    fHistoKeyDisabled[histoKey] = IsHistogramDisabled(fHistoKeyNames[histoKey].c_str()) ? 1 : 0;
+  }
+  return ( fHistoKeyDisabled[histoKey] == 1 );
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuBase::IsHistogrammingDisabled() const
 {
@@ -560,6 +597,103 @@ Bool_t AliAnalysisMuMuBase::IsHistogrammingDisabled() const
   return kFALSE;
 }
 
+//_____________________________________________________________________________
+TObject* AliAnalysisMuMuBase::ObjectByKey(Int_t pathKey, Int_t histoKey)
+{
+  /// Get one object back from its path and histogram keys.
+  /// The collection is only searched until the object is found,
+  /// afterwards it is taken from the table.
+
+  std::vector<TObject*>& row = fObjectTable[pathKey];
+
+  if ( histoKey < static_cast<Int_t>(row.size()) && row[histoKey] ) return row[histoKey];
+
+  if ( !fHistogramCollection ) return 0x0;
+
+  TObject* o = fHistogramCollection->GetObject(fPathKeyNames[pathKey].c_str(),fHistoKeyNames[histoKey].c_str());
+
+  if ( o )
+  {
+    if ( histoKey >= static_cast<Int_t>(row.size()) ) row.resize(fHistoKeyNames.size(),0x0);
+    row[histoKey] = o;
+  }
+  return o;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::PathKey(const char* eventSelection, const char* triggerClassName,
+                                   const char* centrality, const char* what, Bool_t mc)
+{
+  /// Get the key of the path /eventSelection/triggerClassName/centrality[/what]
+  /// (prefixed with MCInputPrefix() if mc is true), i.e. the same identifiers as
+  /// used by Histo and MCHisto.
+  /// The path string is built only the first time a combination is seen. The last
+  /// combination is remembered (separately for data and MC), so that the repeated
+  /// calls for the same combination in the track and pair loops only compare the
+  /// components.
+
+  Int_t slot = mc ? 1 : 0;
+  std::string* last = &fLastPath[4*slot];
+
+  if ( fLastPathKey[slot] >= 0 &&
+       last[0] == eventSelection && last[1] == triggerClassName &&
+       last[2] == centrality && last[3] == what )
+  {
+    return fLastPathKey[slot];
+  }
+
+  TString path;
+  if ( mc ) path.Form("/%s/%s/%s/%s",MCInputPrefix(),eventSelection,triggerClassName,centrality);
+  else path.Form("/%s/%s/%s",eventSelection,triggerClassName,centrality);
+  if ( strlen(what) > 0 )
+  {
+    path += "/";
+    path += what;
+  }
+
+  Int_t key(-1);
+  std::map<std::string,Int_t>::const_iterator it = fPathKeys.find(path.Data());
+
+  if ( it != fPathKeys.end() )
+  {
+    key = it->second;
+  }
+  else
+  {
+    key = fPathKeyNames.size();
+    fPathKeys[path.Data()] = key;
+    fPathKeyNames.push_back(path.Data());
+    fObjectTable.push_back(std::vector<TObject*>());
+  }
+
+  last[0] = eventSelection;
+  last[1] = triggerClassName;
+  last[2] = centrality;
+  last[3] = what;
+  fLastPathKey[slot] = key;
+
+  return key;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::HistoKey(const char* histoname)
+{
+  /// Get the key of a histogram name, to be used with ObjectByKey and friends.
+  /// Meant to be called once per name (e.g. when defining the histograms),
+  /// not in the fill loops.
+
+  std::map<std::string,Int_t>::const_iterator it = fHistoKeys.find(histoname);
+
+  if ( it != fHistoKeys.end() ) return it->second;
+
+  Int_t key = fHistoKeyNames.size();
+  fHistoKeys[histoname] = key;
+  fHistoKeyNames.push_back(histoname);
+  fHistoKeyDisabled.push_back(-1);
+
+  return key;
+}
+
 //_____________________________________________________________________________
 TH1* AliAnalysisMuMuBase::MCHisto(const char* eventSelection, const char* triggerClassName, const char* histoname)
 {
@@ -13,6 +13,9 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -101,7 +104,7 @@ public:
   Bool_t AlwaysFalse(const AliVParticle& /*particle*/, const AliVParticle& /*particle*/) const { return kFALSE; }
   void NameOfAlwaysFalse(TString& name) const { name = "NONE"; }
 
-  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; }
+  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; ClearObjectTable(); }
 
 protected:
 
@@ -192,6 +195,24 @@ protected:
   TProfile* MCProf(const char* eventSelection, const char* triggerClassName, const char* cent,
                  const char* what, const char* histoname);
 
+  /** Integer keys for (path, histogram name) lookups in the fill loops.
+   * Paths and histogram names are interned once, the objects are kept in a
+   * dense table indexed by (path key, histogram key)
+   */
+  Int_t PathKey(const char* eventSelection, const char* triggerClassName, const char* centrality,
+                const char* what="", Bool_t mc=kFALSE);
+  Int_t HistoKey(const char* histoname);
+  const char* HistoKeyName(Int_t histoKey) const { return fHistoKeyNames[histoKey].c_str(); }
+  const char* PathKeyName(Int_t pathKey) const { return fPathKeyNames[pathKey].c_str(); }
+
+  TObject* ObjectByKey(Int_t pathKey, Int_t histoKey);
+  TH1* HistoByKey(Int_t pathKey, Int_t histoKey) { return dynamic_cast<TH1*>(ObjectByKey(pathKey,histoKey)); }
+  TProfile* ProfByKey(Int_t pathKey, Int_t histoKey) { return static_cast<TProfile*>(ObjectByKey(pathKey,histoKey)); }
+
+  Bool_t IsHistoKeyDisabled(Int_t histoKey);
+
+  void ClearObjectTable();
+
   Int_t GetNbins(Double_t xmin, Double_t xmax, Double_t xstep);
 
   AliCounterCollection* CounterCollection() const { return fEventCounters; }
@@ -215,7 +236,16 @@ private:
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
 
-  ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
+  std::map<std::string,Int_t> fPathKeys; //! path -> path key
+  std::vector<std::string> fPathKeyNames; //! path key -> path
+  std::map<std::string,Int_t> fHistoKeys; //! histogram name -> histogram key
+  std::vector<std::string> fHistoKeyNames; //! histogram key -> histogram name
+  std::vector<Int_t> fHistoKeyDisabled; //! histogram key -> disabled (-1 = not yet evaluated)
+  std::vector<std::vector<TObject*> > fObjectTable; //! (path key, histogram key) -> object
+  std::vector<std::string> fLastPath; //! components of the last path looked up (data and MC)
+  Int_t fLastPathKey[2]; //! key of the last path looked up (data and MC)
+
+  ClassDef(AliAnalysisMuMuBase,2) // base class for a companion class to AliAnalysisMuMu
 };
 
 #endif
@@ -49,7 +49,9 @@ fMinvBinSize(0.025),
 fMinvMin(0.0),
 fMinvMax(16.0),
 fmcptcutmin(0.0),
-fmcptcutmax(12.0)
+fmcptcutmax(12.0),
+fPairKeys(),
+fMinvKeys()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -330,9 +332,6 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
   // Get total charge in order to get the correct histo name
   Double_t PairCharge = tracki.Charge() + trackj.Charge();
-  TString scharge  = "";
-  if( PairCharge == +2 )      scharge = "PP";
-  else if( PairCharge == -2 ) scharge = "MM";
 
   // Pointers in case running on MC
   Int_t labeli               = 0;
@@ -342,12 +341,14 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
 
-  // Usefull string :)
-  TString smix = IsMixedHisto ? "Mix" : "";
+  // Index of the charge and mix combination in the key tables
+  Int_t chargeIndex = ChargeIndex(PairCharge);
+  Int_t mixIndex    = IsMixedHisto ? 1 : 0;
 
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
-  AliMergeableCollectionProxy* mcProxy(0x0); // to be set later maybe
+  // Keys of the histogram paths (see AliAnalysisMuMuBase::PathKey)
+  if ( fPairKeys.empty() ) CreatePairKeys();
+  Int_t pathKey   = PathKey(eventSelection,triggerClassName,centrality,pairCutName);
+  Int_t mcPathKey = -1; // to be set later maybe
 
   // Construct dimuons vector
   TLorentzVector pi(tracki.Px(),tracki.Py(),tracki.Pz(),
@@ -373,47 +374,23 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     // Check if first track is a muon
     mcTracki = MCEvent()->GetTrack(labeli);
     if(!mcTracki) return;
-    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTracki->PdgCode()) != 13 ) return;
 
     // Check if second track is a muon
     mcTrackj = MCEvent()->GetTrack(labelj);
     if(!mcTrackj) return;
-    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if ( TMath::Abs(mcTrackj->PdgCode()) != 13 ) return;
 
     // Check if tracks has the same mother
     Int_t currMotheri = mcTracki->GetMother();
     Int_t currMotherj = mcTrackj->GetMother();
-    if( currMotheri!=currMotherj ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if( currMotheri<0 ) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if( currMotheri!=currMotherj ) return;
+    if( currMotheri<0 ) return;
 
     // Check if mother is J/psi
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
-    if(!mother){
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
-    if(mother->PdgCode() !=443) {
-      delete proxy;
-      delete mcProxy;
-      return;
-    }
+    if(!mother) return;
+    if(mother->PdgCode() !=443) return;
 
     // Weight tracks if specified
     if(!fWeightMuon)      inputWeightMC = WeightPairDistribution(mother->Pt(),mother->Y());
@@ -423,13 +400,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
     if(!mcTracki || !mcTrackj){
       AliError("Miss one or several MC track");
-      delete proxy;
-      delete mcProxy;
       return;
     }
 
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
+    // Key of the MC path
+    mcPathKey = PathKey(eventSelection,triggerClassName,centrality,pairCutName,kTRUE);
     TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
@@ -441,25 +416,19 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt")  ) {
-    Double_t x[2] = {pair4Momentum.Pt(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Pt%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
-  }
-  if ( !IsHistogramDisabled("Y")   ){
-    Double_t x[2] = {pair4Momentum.Rapidity(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Y%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
-  }
-  if ( !IsHistogramDisabled("Eta") ){
-    Double_t x[2] = {pair4Momentum.Eta(),pair4Momentum.M()};
-    if(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))
-      static_cast<THnSparse*>(proxy->GetObject(Form("Eta%s%s",smix.Data(),scharge.Data())))->Fill(x,inputWeight);
+  Double_t xpair[3] = {pair4Momentum.Pt(),pair4Momentum.Rapidity(),pair4Momentum.Eta()};
+  for ( Int_t i = 0; i < 3; ++i ){
+    // disabled flag from the plain name (Pt, Y, Eta)
+    if ( IsHistoKeyDisabled(fPairKeys[PairKeyIndex(i,0,0)]) ) continue;
+    THnSparse* h = static_cast<THnSparse*>(ObjectByKey(pathKey,fPairKeys[PairKeyIndex(i,mixIndex,chargeIndex)]));
+    Double_t x[2] = {xpair[i],pair4Momentum.M()};
+    if ( h ) h->Fill(x,inputWeight);
   }
 
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( !IsHistoKeyDisabled(fPairKeys[kPtPaireVsPtTrack]) && !IsMixedHisto &&  static_cast<int>(PairCharge) == 0) {
+    TH2* h = static_cast<TH2*>(HistoByKey(pathKey,fPairKeys[kPtPaireVsPtTrack]));
+    h->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+    h->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
   }
 
   // Fill histos with MC stack info (only opposite charge muons)
@@ -472,10 +441,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
 
     // Fill histo
-    if ( proxy->Histo("PtRecVsSim") )  proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( mcProxy->Histo("Pt"))  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( mcProxy->Histo("Y"))   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( mcProxy->Histo("Eta")) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    TH1* h(0x0);
+    if ( ( h = HistoByKey(pathKey,fPairKeys[kPtRecVsSim]) ) )           h->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( ( h = HistoByKey(mcPathKey,fPairKeys[PairKeyIndex(0,0,0)]) ) ) h->Fill(mcpj.Pt(),inputWeightMC);
+    if ( ( h = HistoByKey(mcPathKey,fPairKeys[PairKeyIndex(1,0,0)]) ) ) h->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( ( h = HistoByKey(mcPathKey,fPairKeys[PairKeyIndex(2,0,0)]) ) ) h->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
@@ -484,9 +454,11 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   TIter nextBin(fBinsToFill);
   nextBin.Reset();
   AliAnalysisMuMuBinning::Range* r;
+  Int_t ibin(-1);
 
   // Loop over all bin ranges
   while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
+    ++ibin;
 
     // --- In this loop we first check if the pairs pass some tests and we fill histo accordingly. ---
 
@@ -494,19 +466,17 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     Bool_t ok(kFALSE);
     Bool_t okMC(kFALSE);
 
-    ok = CheckBinRangeCut(r,&pair4Momentum,proxy);
-    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,proxy);
+    ok = CheckBinRangeCut(r,&pair4Momentum,pathKey);
+    if( pair4MomentumMC ) okMC = CheckBinRangeCut(r,pair4MomentumMC,pathKey);
 
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok )
     {
-      // Get Minv histo name associated to the bin
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight);
+      // Get Minv histo keys associated to the bin
+      const Int_t* keys      = MinvKeys(ibin,*r,kFALSE,chargeIndex,mixIndex);
+      TProfile* hprof        = ProfByKey(pathKey,keys[1]);
+      TProfile* hprofsquare  = ProfByKey(pathKey,keys[2]);
+      FillMinvHisto(pathKey,keys[0],hprof,hprofsquare,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() )
@@ -519,23 +489,19 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4Momentum.Pt(),pair4Momentum.Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,proxy,&pair4Momentum,inputWeight/AccxEff);
+        keys            = MinvKeys(ibin,*r,kTRUE,chargeIndex,mixIndex);
+        hprof           = ProfByKey(pathKey,keys[1]);
+        hprofsquare     = ProfByKey(pathKey,keys[2]);
+        if( okAccEff ) FillMinvHisto(pathKey,keys[0],hprof,hprofsquare,&pair4Momentum,inputWeight/AccxEff);
       }
     }
 
     if ( okMC ) {
 
-      TString minvName       = GetMinvHistoName(*r,kFALSE,PairCharge,IsMixedHisto);
-      TString hprofName      = Form("MeanPtVs%s",minvName.Data());
-      TString hprofNameSquare= Form("MeanPtSquareVs%s",minvName.Data());
-      TProfile* hprof        = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-      TProfile* hprofsquare  = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-      FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight);
+      const Int_t* keys      = MinvKeys(ibin,*r,kFALSE,chargeIndex,mixIndex);
+      TProfile* hprof        = ProfByKey(mcPathKey,keys[1]);
+      TProfile* hprofsquare  = ProfByKey(mcPathKey,keys[2]);
+      FillMinvHisto(mcPathKey,keys[0],hprof,hprofsquare,&pair4Momentum,inputWeight);
 
       // Create, fill and store Minv histo already corrected with accxeff
       if ( ShouldCorrectDimuonForAccEff() ){
@@ -548,18 +514,14 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
         if ( AccxEff <= 0.0 ) AliError(Form("AccxEff < 0 for pt = %f & y = %f ",pair4MomentumMC->Pt(),pair4MomentumMC->Rapidity()));
         else okAccEff = kTRUE;
 
-        minvName        = GetMinvHistoName(*r,kTRUE,PairCharge,IsMixedHisto);
-        hprofName       = Form("MeanPtVs%s",minvName.Data());
-        hprofNameSquare = Form("MeanPtSquareVs%s",minvName.Data());
-        hprof           = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-        hprofsquare     = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofNameSquare.Data());
-        if( okAccEff ) FillMinvHisto(&minvName,hprof,hprofsquare,mcProxy,&pair4Momentum,inputWeight/AccxEff);
+        keys            = MinvKeys(ibin,*r,kTRUE,chargeIndex,mixIndex);
+        hprof           = ProfByKey(mcPathKey,keys[1]);
+        hprofsquare     = ProfByKey(mcPathKey,keys[2]);
+        if( okAccEff ) FillMinvHisto(mcPathKey,keys[0],hprof,hprofsquare,&pair4Momentum,inputWeight/AccxEff);
 
       }
     }
   }
-  delete proxy;
-  delete mcProxy;
 }
 
 
@@ -687,26 +649,68 @@ void AliAnalysisMuMuMinv::FillHistosForMCEvent(const char* eventSelection,const
 }
 
 //_____________________________________________________________________________
-void AliAnalysisMuMuMinv::FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight)
+void AliAnalysisMuMuMinv::FillMinvHisto(Int_t pathKey, Int_t minvKey, TProfile* hprof, TProfile* hprof2, TLorentzVector* pair4Momentum, Double_t inputWeight)
 {
-  /// Create, fill and store Minv histo
-  if (!IsHistogramDisabled(minvName->Data())){
-
-    TH1* h(0x0);
+  /// Fill Minv histo (and mean pt profiles) of the bin with histogram key minvKey
+  if (!IsHistoKeyDisabled(minvKey)){
 
-    h = proxy->Histo(minvName->Data());
+    TH1* h = HistoByKey(pathKey,minvKey);
     if (h) h->Fill(pair4Momentum->M(),inputWeight);
 
     // Fill Mean pT
     if ( fComputeMeanPt ){
-      if ( !hprof ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof ) AliError(Form("Could not get hprofile for %s",HistoKeyName(minvKey)));
       else hprof->Fill(pair4Momentum->M(),pair4Momentum->Pt(),inputWeight);
-      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",minvName->Data()));
+      if ( !hprof2 ) AliError(Form("Could not get hprofile for %s",HistoKeyName(minvKey)));
       else hprof2->Fill(pair4Momentum->M(),pair4Momentum->Pt()*pair4Momentum->Pt(),inputWeight);
     }
   }
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::CreatePairKeys()
+{
+  /// Intern the names of the pair histograms filled for each pair
+
+  const char* var[3]    = {"Pt","Y","Eta"};
+  const char* mix[2]    = {"","Mix"};
+  const char* charge[3] = {"","PP","MM"};
+
+  fPairKeys.assign(kNPairKeys,-1);
+
+  for ( Int_t i = 0; i < 3; ++i )
+    for ( Int_t m = 0; m < 2; ++m )
+      for ( Int_t c = 0; c < 3; ++c )
+        fPairKeys[PairKeyIndex(i,m,c)] = HistoKey(Form("%s%s%s",var[i],mix[m],charge[c]));
+
+  fPairKeys[kPtPaireVsPtTrack] = HistoKey("PtPaireVsPtTrack");
+  fPairKeys[kPtRecVsSim]       = HistoKey("PtRecVsSim");
+  fPairKeys[kNchForJpsi]       = HistoKey("NchForJpsi");
+  fPairKeys[kNchForPsiP]       = HistoKey("NchForPsiP");
+}
+
+//_____________________________________________________________________________
+const Int_t* AliAnalysisMuMuMinv::MinvKeys(Int_t ibin, const AliAnalysisMuMuBinning::Range& r,
+                                           Bool_t accEffCorrected, Int_t chargeIndex, Int_t mixIndex)
+{
+  /// Histogram keys of the Minv, MeanPtVs and MeanPtSquareVs histograms
+  /// of bin ibin of fBinsToFill. The names are built only once.
+
+  if ( fMinvKeys.empty() ) fMinvKeys.assign(3*12*fBinsToFill->GetEntries(),-1);
+
+  Int_t* keys = &fMinvKeys[3*(((ibin*2+(accEffCorrected ? 1 : 0))*3+chargeIndex)*2+mixIndex)];
+
+  if ( keys[0] < 0 )
+  {
+    const Double_t charge[3] = {0,2,-2};
+    TString minvName = GetMinvHistoName(r,accEffCorrected,charge[chargeIndex],mixIndex==1);
+    keys[0] = HistoKey(minvName.Data());
+    keys[1] = HistoKey(Form("MeanPtVs%s",minvName.Data()));
+    keys[2] = HistoKey(Form("MeanPtSquareVs%s",minvName.Data()));
+  }
+  return keys;
+}
+
 //_____________________________________________________________________________
 TString AliAnalysisMuMuMinv::GetMinvHistoName(const AliAnalysisMuMuBinning::Range& r, Bool_t accEffCorrected, Double_t PairCharge, Bool_t mix) const
 {
@@ -818,7 +822,7 @@ Bool_t AliAnalysisMuMuMinv::IsPtInRange(const AliVParticle& t1, const AliVPartic
 }
 
 //_____________________________________________________________________________
-Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy)
+Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, Int_t pathKey)
 {
   /// Check if our pairs match conditions from the binning range
 
@@ -835,7 +839,7 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
     // Fill NchForJpsi histo according to pair4Momentum.M()
     if ( pair4Momentum->M() >= 2.9 && pair4Momentum->M() <= 3.3 ){
 
-      h = proxy->Histo("NchForJpsi");
+      h = HistoByKey(pathKey,fPairKeys[kNchForJpsi]);
 
       Double_t ntrcorr = (-1.);
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -859,7 +863,7 @@ Bool_t AliAnalysisMuMuMinv::CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, T
     }
     else if ( pair4Momentum->M() >= 3.6 && pair4Momentum->M() <= 3.9){
 
-      h = proxy->Histo("NchForPsiP");
+      h = HistoByKey(pathKey,fPairKeys[kNchForPsiP]);
       Double_t ntrcorr = (-1.);
 
       TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -1110,6 +1114,7 @@ void AliAnalysisMuMuMinv::SetBinsToFill(const char* particle, const char* bins)
 {
   delete fBinsToFill;
   fBinsToFill = Binning()->CreateBinObjArray(particle,bins,"");
+  fMinvKeys.clear();
 }
 
 //________________________________________________________________________
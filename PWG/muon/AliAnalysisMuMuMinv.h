@@ -72,7 +72,7 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
-  void FillMinvHisto(TString* minvName,TProfile* hprof,TProfile* hprof2,AliMergeableCollectionProxy* proxy, TLorentzVector* pair4Momentum, Double_t inputWeight);
+  void FillMinvHisto(Int_t pathKey, Int_t minvKey, TProfile* hprof, TProfile* hprof2, TLorentzVector* pair4Momentum, Double_t inputWeight);
 
 private:
 
@@ -91,7 +91,18 @@ private:
 
   Double_t TriggerLptApt(Double_t *x, Double_t *par);
 
-  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, AliMergeableCollectionProxy* proxy);
+  Bool_t  CheckBinRangeCut(AliAnalysisMuMuBinning::Range* r, TLorentzVector* pair4Momentum, Int_t pathKey);
+
+  /// Keys of the per pair histograms in fPairKeys: (Pt,Y,Eta) x (mix) x (charge 0,++,--), then the single ones
+  enum EPairKey { kPtPaireVsPtTrack=18, kPtRecVsSim, kNchForJpsi, kNchForPsiP, kNPairKeys };
+
+  Int_t PairKeyIndex(Int_t var, Int_t mixIndex, Int_t chargeIndex) const { return (var*2+mixIndex)*3+chargeIndex; }
+
+  Int_t ChargeIndex(Double_t pairCharge) const { return ( pairCharge == 2 ) ? 1 : ( ( pairCharge == -2 ) ? 2 : 0 ); }
+
+  void CreatePairKeys();
+
+  const Int_t* MinvKeys(Int_t ibin, const AliAnalysisMuMuBinning::Range& r, Bool_t accEffCorrected, Int_t chargeIndex, Int_t mixIndex);
 
   Bool_t CheckMCTracksMatchingStackAndMother(Int_t labeli, Int_t labelj, AliVParticle* mcTracki, AliVParticle* mcTrackj, Double_t inputWeightMC);
 
@@ -111,8 +122,10 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  std::vector<Int_t> fPairKeys; //! histogram keys of the per pair histograms (see EPairKey)
+  std::vector<Int_t> fMinvKeys; //! histogram keys of the Minv and mean pt histograms per bin of fBinsToFill
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
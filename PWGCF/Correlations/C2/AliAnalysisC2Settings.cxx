@@ -26,7 +26,8 @@ AliAnalysisC2Settings::AliAnalysisC2Settings() :
   fUseV0(false),
   fUseSPDclusters(false),
   fUseTracklets(false),
-  fUseTracks(false)
+  fUseTracks(false),
+  fUseOccupancyMaps(false)
 {
   Double_t _ptbins[] = {3.0, 4.0, 6.0, 8.0, 15.0};
   fPtBinEdges = edgeContainer(_ptbins, _ptbins + sizeof(_ptbins) / sizeof(_ptbins[0]));
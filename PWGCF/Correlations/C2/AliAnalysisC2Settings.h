@@ -79,8 +79,12 @@ class AliAnalysisC2Settings : public TObject {
   Bool_t fUseTracklets;
   /// Use Central tracks
   Bool_t fUseTracks;
+  /// Fill the pair histograms from per-event (eta, phi) occupancy maps
+  /// instead of looping over all pairs. Only used if the trigger is
+  /// chosen by eta, ie. if there is no pT binning (fPtBinEdges.size() <= 2)
+  Bool_t fUseOccupancyMaps;
 
 private:
-  ClassDef(AliAnalysisC2Settings, 1);
+  ClassDef(AliAnalysisC2Settings, 2);
 };
 #endif
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -187,6 +188,10 @@ void AliAnalysisTaskC2::UserCreateOutputObjects()
     this->fOutputList->Add(this->fEtaPhiZvtx_max_res);
   }
   
+  if (this->fSettings.fUseOccupancyMaps && this->fSettings.fPtBinEdges.size() > 2) {
+    AliWarning("Occupancy maps need the trigger to be chosen by eta (no pT binning); filling pairs in the pair loop");
+  }
+
   AliLog::SetGlobalLogLevel(AliLog::kError);
   PostData(1, fOutputList);
 }
@@ -260,28 +265,109 @@ void AliAnalysisTaskC2::UserExec(Option_t *)
     Int_t i_pt;
     Int_t i_mult;
     Int_t i_zvtx;
+    Int_t i_region;
     AliAnalysisTaskValidation::Track track;
   };
   // Find the bin indices here instead of doing it (implicity in the loop) which is super slow
   vector<Bin_indices> track_bin_idxs;
   for (auto t: tracks) {
-    THn *hist;
+    Int_t region;
     if (t.eta < this->fSettings.fEtaEdgesIts[0]) {
-      hist = this->fsingleHists[0];
+      region = 0;
     } else if (t.eta >= this->fSettings.fEtaEdgesIts[0] && t.eta < this->fSettings.fEtaEdgesFwd[0]) {
-      hist = this->fsingleHists[1];
+      region = 1;
     } else {
-      hist = this->fsingleHists[2];
+      region = 2;
     }
+    THn *hist = this->fsingleHists[region];
     track_bin_idxs.push_back(Bin_indices {
 	hist->GetAxis(cSinglesDims::kEta)->FindFixBin(t.eta),
 	hist->GetAxis(cSinglesDims::kPhi)->FindFixBin(AliAnalysisC2Utils::Wrap02pi(t.phi)),
 	hist->GetAxis(cSinglesDims::kPt)->FindFixBin(t.pt),
 	hist->GetAxis(cSinglesDims::kMult)->FindFixBin(multiplicity),
 	hist->GetAxis(cSinglesDims::kZvtx)->FindFixBin(zvtx),
+	region,
 	t});
   }
   // Fill the pair particle histograms
+  if (this->fSettings.fUseOccupancyMaps && this->fSettings.fPtBinEdges.size() <= 2) {
+    // The trigger is the track with the larger eta. The eta bins of the three regions,
+    // including under- and overflow, form a sequence of cells ordered in eta, so for
+    // two tracks in different cells the trigger is the one in the later cell. Those
+    // pairs are filled as outer products of the per cell phi occupancies.
+    // Within one cell the eta order of the tracks matters; these pairs are filled by
+    // going through the tracks in eta with a running phi occupancy of the preceding
+    // tracks, which also leaves out the pairing of a track with itself.
+    // Same content as the pair loop up to rounding, in O(N*nPhi + nOccupied^2)
+    const Int_t nPhi = this->fSettings.fNPhiBins + 2;
+    Int_t cellOffset[4] = {0};
+    for (Int_t r = 0; r < 3; r++) {
+      cellOffset[r + 1] = cellOffset[r] + this->fsingleHists[r]->GetAxis(cSinglesDims::kEta)->GetNbins() + 2;
+    }
+    // Equal eta keeps the input order: the pair loop makes the later track the trigger
+    vector<UInt_t> order(track_bin_idxs.size());
+    for (UInt_t i = 0; i < order.size(); i++) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+		     [&track_bin_idxs] (UInt_t a, UInt_t b)
+		     {return track_bin_idxs[a].track.eta < track_bin_idxs[b].track.eta;});
+
+    const Int_t ptPairBin = AliAnalysisC2Utils::ComputePtPairBin(1, 1) + 1; // see FIXME in the pair loop
+    vector<Double_t> occupancy(cellOffset[3] * nPhi, 0);
+    vector<Double_t> running(nPhi);
+    vector<Double_t> sameCell(nPhi * nPhi);
+    vector<Bin_indices*> occupiedCells;  // first track of each occupied cell, in eta
+    for (UInt_t begin = 0; begin < order.size();) {
+      Bin_indices *first = &track_bin_idxs[order[begin]];
+      const Int_t cell = cellOffset[first->i_region] + first->i_eta;
+      std::fill(running.begin(), running.end(), 0);
+      std::fill(sameCell.begin(), sameCell.end(), 0);
+      UInt_t end = begin;
+      for (; end < order.size(); end++) {
+	const Bin_indices &t = track_bin_idxs[order[end]];
+	if (cellOffset[t.i_region] + t.i_eta != cell) break;
+	for (Int_t iPhi = 0; iPhi < nPhi; iPhi++) {
+	  if (running[iPhi] != 0) sameCell[iPhi * nPhi + t.i_phi] += running[iPhi] * t.track.weight;
+	}
+	running[t.i_phi] += t.track.weight;
+      }
+      std::copy(running.begin(), running.end(), occupancy.begin() + cell * nPhi);
+      occupiedCells.push_back(first);
+      THn *pairHist = this->fpairHists[this->GetPairHistIndex(first->track.eta, first->track.eta)];
+      for (Int_t iPhiAssoc = 0; iPhiAssoc < nPhi; iPhiAssoc++) {
+	for (Int_t iPhiTrigger = 0; iPhiTrigger < nPhi; iPhiTrigger++) {
+	  const Double_t w = sameCell[iPhiAssoc * nPhi + iPhiTrigger];
+	  if (w == 0) continue;
+	  Int_t stuffing[7] =
+	    {first->i_eta, first->i_eta, iPhiAssoc, iPhiTrigger, ptPairBin, first->i_mult, first->i_zvtx};
+	  pairHist->AddBinContent(stuffing, w * evWeight);
+	}
+      }
+      begin = end;
+    }
+    // Pairs of tracks in different cells
+    for (UInt_t iAssoc = 0; iAssoc < occupiedCells.size(); iAssoc++) {
+      const Bin_indices *assoc = occupiedCells[iAssoc];
+      const Double_t *occAssoc = &occupancy[(cellOffset[assoc->i_region] + assoc->i_eta) * nPhi];
+      for (UInt_t iTrigger = iAssoc + 1; iTrigger < occupiedCells.size(); iTrigger++) {
+	const Bin_indices *trigger = occupiedCells[iTrigger];
+	const Double_t *occTrigger = &occupancy[(cellOffset[trigger->i_region] + trigger->i_eta) * nPhi];
+	THn *pairHist = this->fpairHists[this->GetPairHistIndex(trigger->track.eta, assoc->track.eta)];
+	for (Int_t iPhiAssoc = 0; iPhiAssoc < nPhi; iPhiAssoc++) {
+	  if (occAssoc[iPhiAssoc] == 0) continue;
+	  for (Int_t iPhiTrigger = 0; iPhiTrigger < nPhi; iPhiTrigger++) {
+	    if (occTrigger[iPhiTrigger] == 0) continue;
+	    Int_t stuffing[7] =
+	      {assoc->i_eta, trigger->i_eta, iPhiAssoc, iPhiTrigger, ptPairBin, assoc->i_mult, assoc->i_zvtx};
+	    pairHist->AddBinContent(stuffing, occAssoc[iPhiAssoc] * occTrigger[iPhiTrigger] * evWeight);
+	  }
+	}
+      }
+    }
+    PostData(1, this->fOutputList);
+    return;
+  }
   Bin_indices *trigger, *assoc;
   for (UInt_t i = 0; i < track_bin_idxs.size(); i++) {
     // Do not pair with itself and drop mirrored pairs
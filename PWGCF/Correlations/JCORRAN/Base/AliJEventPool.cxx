@@ -45,10 +45,15 @@ AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin,
     }
   } cout <<endl; 
 
-  for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
-    for(int ie=0;ie<fcard->GetEventPoolDepth(ic); ie++){ 
-      fLists[ic][ie]  = new TClonesArray(kParticleProtoType[particle],1500);
+  // the mix lists are created when an event is first stored in them:
+  // most of the pool depth is never used in the low multiplicity bins
+  for(int ic=0;ic<kMaxNoCentrBin;ic++){
+    for(int ie=0;ie<MAXNOEVENT; ie++){ 
+      fLists[ic][ie]  = NULL;
+      fnoTracks[ic][ie] = 0;
     }
+  }
+  for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
     flastAccepted[ic] = -1; //to start from 0
     fwhereToStore[ic] = -1; //to start from 0
     fnoMix[ic]    = 0;
@@ -66,6 +71,11 @@ AliJEventPool::~AliJEventPool( ){
   //delete ftk;
   //delete ftk1;
   //delete ftk2;
+  for(int ic=0;ic<kMaxNoCentrBin;ic++){
+    for(int ie=0;ie<MAXNOEVENT; ie++){
+      delete fLists[ic][ie];
+    }
+  }
 }  
 
 AliJEventPool::AliJEventPool(const AliJEventPool& obj) :
@@ -80,6 +90,14 @@ AliJEventPool::AliJEventPool(const AliJEventPool& obj) :
 {
   // copy constructor
   JUNUSED(obj);
+  for(int ic=0;ic<kMaxNoCentrBin;ic++){
+    for(int ie=0;ie<MAXNOEVENT; ie++){
+      fLists[ic][ie]  = NULL;
+      fnoTracks[ic][ie] = 0;
+    }
+    flastAccepted[ic] = -1;
+    fwhereToStore[ic] = -1;
+  }
 }
 
 AliJEventPool& AliJEventPool::operator=(const AliJEventPool& obj){
@@ -105,10 +123,10 @@ void AliJEventPool::Mix( TClonesArray *triggList,
 
 
     for(int backCounter=0; backCounter <= flastAccepted[cBin]; backCounter++){
-        fpoolList = fLists [cBin] [backCounter];
-        noAssoc = fpoolList->GetEntries();
+        noAssoc = fnoTracks[cBin][backCounter];
 
         if(noAssoc<=0) continue;
+        fpoolList = fLists [cBin] [backCounter];
 
         //mixit=======
         fnoMix[cBin]++;
@@ -116,7 +134,7 @@ void AliJEventPool::Mix( TClonesArray *triggList,
         if( 
                 fcard->SimilarCentrality(fcentrality[cBin][backCounter], cent, cBin) &&
                 fcard->SimilarMultiplicity(fmult[cBin][backCounter], thisMult) &&
-                fcard->GetBin(kZVertType, fZVertex[cBin][backCounter])==zBin      &&
+                fzBin[cBin][backCounter]==zBin      &&
                 fevent[cBin][backCounter] != iev )
         {
             fnoMixCut[cBin]++;
@@ -152,7 +170,10 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     fZVertex   [cBin][fwhereToStore[cBin]] = Z;
     fcentrality[cBin][fwhereToStore[cBin]] = cent;
     fmult      [cBin][fwhereToStore[cBin]] = inMult;
+    fzBin      [cBin][fwhereToStore[cBin]] = fcard->GetBin(kZVertType, Z);
+    fnoTracks  [cBin][fwhereToStore[cBin]] = inList->GetEntriesFast();
 
+    if( !fLists[cBin][fwhereToStore[cBin]] ) fLists[cBin][fwhereToStore[cBin]] = new TClonesArray(kParticleProtoType[fthisPoolType],1500);
     fLists[cBin][fwhereToStore[cBin]]->Clear();
     for(int i=0;i<inList->GetEntriesFast();i++){
 				if( fthisPoolType == kJPhoton || fthisPoolType == kJDecayphoton ){
@@ -55,12 +55,14 @@ class AliJEventPool {
         float fZVertex[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fcentrality[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fmult[kMaxNoCentrBin][MAXNOEVENT];  // comment me
+        int   fzBin[kMaxNoCentrBin][MAXNOEVENT];  // z-vertex bin of the stored event
+        int   fnoTracks[kMaxNoCentrBin][MAXNOEVENT];  // number of particles of the stored event
         long  flastAccepted[kMaxNoCentrBin];  // comment me
         long fwhereToStore[kMaxNoCentrBin];   // comment me
         long fnoMix[kMaxNoCentrBin];  // comment me
         long fnoMixCut[kMaxNoCentrBin];   // comment me
 
-        TClonesArray   *fLists[kMaxNoCentrBin][MAXNOEVENT]; // mix lists
+        TClonesArray   *fLists[kMaxNoCentrBin][MAXNOEVENT]; // mix lists, created when first used
         AliJCard  *fcard;  // card
         AliJCorrelationInterface *fcorrelations; // correlation object
         AliJHistogramInterface *fhistos;  // histos
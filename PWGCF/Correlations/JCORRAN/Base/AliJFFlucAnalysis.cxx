@@ -394,6 +394,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	fh_ntracks[fCBin]->Fill( trk_number ) ;
 	fh_cent->Fill(fCent) ;
 	fh_ImpactParameter->Fill( fImpactParameter);
+	FillTrackArrays();
 	Fill_QA_plot( fEta_min, fEta_max );
 
 	enum{kSubA, kSubB, kNSub};
@@ -665,16 +666,12 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 			}
 		}
 
-		// calculate Qn for each pt bin
+		// calculate Qn for each pt bin, all harmonics and pt bins in one track loop per subevent
+		CalculateQvectorsPt(Eta_config[kSubA][0], Eta_config[kSubA][1], 2, SCNH, ptbin_borders, QnA_pt);
+		CalculateQvectorsPt(Eta_config[kSubB][0], Eta_config[kSubB][1], 2, SCNH, ptbin_borders, QnB_pt);
 		for(int ih=2; ih<SCNH; ih++){
-			for(int ipt=0; ipt<N_ptbins; ipt++){
-				Double_t pt_bin_min = ptbin_borders[ipt];
-				Double_t pt_bin_max = ptbin_borders[ipt+1];
-				QnA_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-				QnB_pt[ih][ipt] = Get_Qn_pt(Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
+			for(int ipt=0; ipt<N_ptbins; ipt++)
 				QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ;
-			}
 		}
 
 		for(int ipt=0; ipt<N_ptbins; ipt++){
@@ -718,19 +715,23 @@ void AliJFFlucAnalysis::Terminate(Option_t *)
 }
 //________________________________________________________________________
 //________________________________________________________________________
-void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
+void AliJFFlucAnalysis::FillTrackArrays()
 {
+	// Copy the kinematics of the input tracks into flat arrays and look up
+	// the phi module and efficiency corrections once per track and event.
+	// Used by all the track loops below, which run many times per event.
 	Long64_t ntracks = fInputList->GetEntriesFast();
+	fTrackEta.resize(ntracks);
+	fTrackPhi.resize(ntracks);
+	fTrackPt.resize(ntracks);
+	fTrackPhiCorr.resize(ntracks);
+	fTrackEffCorr.resize(ntracks);
+	fTrackWeight.resize(ntracks);
 	for( Long64_t it=0; it < ntracks; it++){
 		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
 		Double_t eta = itrack->Eta();
 		Double_t phi = itrack->Phi();
-
-		fh_phieta[fCBin]->Fill(phi,eta);
-		fh_phietaz[fCBin]->Fill(phi,eta,fVertex[2]);
-
-		if(TMath::Abs(eta) < eta1 || TMath::Abs(eta) > eta2)
-			continue;
+		Double_t pt = itrack->Pt();
 
 		Double_t phi_module_corr = 1.0;
 		if(flags & FLUC_PHI_CORRECTION && pPhiWeights){
@@ -739,10 +740,33 @@ void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 			if(w > 1e-6)
 				phi_module_corr = w;
 		}
-
-		Double_t pt = itrack->Pt();
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
-		Double_t effInv = 1.0/effCorr;
+
+		fTrackEta[it] = eta;
+		fTrackPhi[it] = phi;
+		fTrackPt[it] = pt;
+		fTrackPhiCorr[it] = phi_module_corr;
+		fTrackEffCorr[it] = effCorr;
+		fTrackWeight[it] = 1.0/(phi_module_corr*effCorr);
+	}
+}
+//________________________________________________________________________
+void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
+{
+	Long64_t ntracks = fTrackEta.size();
+	for( Long64_t it=0; it < ntracks; it++){
+		Double_t eta = fTrackEta[it];
+		Double_t phi = fTrackPhi[it];
+
+		fh_phieta[fCBin]->Fill(phi,eta);
+		fh_phietaz[fCBin]->Fill(phi,eta,fVertex[2]);
+
+		if(TMath::Abs(eta) < eta1 || TMath::Abs(eta) > eta2)
+			continue;
+
+		Double_t phi_module_corr = fTrackPhiCorr[it];
+		Double_t pt = fTrackPt[it];
+		Double_t effInv = 1.0/fTrackEffCorr[it];
 		fh_eta[fCBin]->Fill(eta,effInv);
 		fh_pt[fCBin]->Fill(pt,effInv);
 		fh_phi[fCBin][(int)(eta > 0.0)]->Fill( phi, effInv/phi_module_corr);
@@ -837,6 +861,49 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 
 	return Qn;
 }
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQvectorsPt(Double_t eta1, Double_t eta2, int hmin, int hmax, const Double_t *ptBorders, TComplex (*Qn)[N_ptbins])
+{
+	// Same as Get_Qn_pt for harmonics hmin..hmax-1 and all the pt bins
+	// (borders included on both sides), with a single track loop.
+	Double_t Sub_Ntrk[N_ptbins];
+	for(int ipt=0; ipt<N_ptbins; ipt++){
+		Sub_Ntrk[ipt] = 0;
+		for(int ih=hmin; ih<hmax; ih++)
+			Qn[ih][ipt] = TComplex(0,0);
+	}
+
+	Double_t c[kNH], s[kNH];
+	Long64_t ntracks = fTrackEta.size();
+	for( Long64_t it = 0; it < ntracks; it++){
+		Double_t eta = fTrackEta[it];
+		if(eta < eta1 || eta > eta2)
+			continue;
+		Double_t pt = fTrackPt[it];
+		if(pt < ptBorders[0] || pt > ptBorders[N_ptbins])
+			continue;
+		Double_t phi = fTrackPhi[it];
+		Double_t tf = fTrackWeight[it];
+		for(int ih=hmin; ih<hmax; ih++){
+			c[ih] = TMath::Cos(ih*phi);
+			s[ih] = TMath::Sin(ih*phi);
+		}
+		for(int ipt=0; ipt<N_ptbins; ipt++){
+			if(pt < ptBorders[ipt] || pt > ptBorders[ipt+1])
+				continue;
+			for(int ih=hmin; ih<hmax; ih++)
+				Qn[ih][ipt] += TComplex(tf*c[ih],tf*s[ih]);
+			Sub_Ntrk[ipt] += tf;
+		}
+	}
+
+	int iside = (int)(eta1 > 0.0);
+	for(int ipt=0; ipt<N_ptbins; ipt++){
+		for(int ih=hmin; ih<hmax; ih++)
+			Qn[ih][ipt] /= Sub_Ntrk[ipt];
+		NSubTracks_pt[iside][ipt] = Sub_Ntrk[ipt];
+	}
+}
 ///________________________________________________________________________
 /* new Function for QC method
    Please see Generic Framwork from Ante
@@ -854,10 +921,9 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 	} // for max harmonics
 	//Calculate Q-vector with particle loop
-	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
+	Long64_t ntracks = fTrackEta.size(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
-		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
-		Double_t eta = itrack->Eta();
+		Double_t eta = fTrackEta[it];
 		// track Eta cut Note! pt cuts already applied in AliJFFlucTask.cxx
 		// Do we need arbitary Eta cut for QC method?
 		// fixed eta ranged -0.8 < eta < 0.8 for QC
@@ -871,30 +937,24 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		/////////////////////////////////////////////////
 
 		int isub = (int)(eta > 0.0);
-		Double_t phi = itrack->Phi();
-		Double_t pt = itrack->Pt();
+		Double_t phi = fTrackPhi[it];
+		//this is for normalized SC ( denominator needs an eta gap )
+		Bool_t isGap = TMath::Abs(eta) > etamin;//fQC_eta_gap_half)
 
-		Double_t phi_module_corr = 1.0;
-		if(flags & FLUC_PHI_CORRECTION && pPhiWeights){
-			Double_t w = pPhiWeights->GetBinContent(
-				pPhiWeights->FindBin(phi,eta,fVertex[2]));
-			if(w > 1e-6)
-				phi_module_corr = w;
-		}
-		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
+		// powers of the track weight, the same for all harmonics
+		Double_t tf[nKL];
+		tf[0] = 1.0;
+		for(int ik=1; ik<nKL; ik++)
+			tf[ik] = tf[ik-1]*fTrackWeight[it];
 
 		for(int ih=0; ih<kNH; ih++){
-			Double_t tf = 1.0;
-			TComplex q[nKL];
+			Double_t c = TMath::Cos(ih*phi);
+			Double_t s = TMath::Sin(ih*phi);
 			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
-
-				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
-
-				tf *= 1.0/(phi_module_corr*effCorr);
+				TComplex q(tf[ik]*c,tf[ik]*s);
+				QvectorQC[ih][ik] += q;
+				if(isGap)
+					QvectorQCeta10[isub][ih][ik] += q;
 			}
 		}
 	} // track loop done.
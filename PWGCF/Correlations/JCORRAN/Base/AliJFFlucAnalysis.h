@@ -9,6 +9,7 @@
 #include "AliJHistManager.h"
 #include "AliVVertex.h"
 #include <TComplex.h>
+#include <vector>
 
 class TClonesArray;
 class AliJBaseTrack;
@@ -166,6 +167,15 @@ private:
 	// additional variables for ptbins(Standard Candles only)
 	enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 	double NSubTracks_pt[2][N_ptbins];
+	void CalculateQvectorsPt(double eta1, double eta2, int hmin, int hmax, const double *ptBorders, TComplex (*Qn)[N_ptbins]);
+	void FillTrackArrays();
+	// per event track arrays, filled once by FillTrackArrays() and shared by the Q-vector loops
+	std::vector<Double_t> fTrackEta;//!
+	std::vector<Double_t> fTrackPhi;//!
+	std::vector<Double_t> fTrackPt;//!
+	std::vector<Double_t> fTrackPhiCorr;//! // phi module correction (1 if not applied)
+	std::vector<Double_t> fTrackEffCorr;//! // efficiency correction
+	std::vector<Double_t> fTrackWeight;//! // 1/(phi_module_corr*effCorr)
 	AliJBin fBin_Nptbins;//!
 	AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 	AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
@@ -177,7 +187,7 @@ private:
 	//AliJTH1D fh_QvectorQCphi;//!
 	AliJTH1D fh_evt_SP_QC_ratio_2p;//! // check SP QC evt by evt ratio
 	AliJTH1D fh_evt_SP_QC_ratio_4p;//! // check SP QC evt by evt ratio
-	ClassDef(AliJFFlucAnalysis, 1); // example of analysis
+	ClassDef(AliJFFlucAnalysis, 2); // example of analysis
 };
 
 #endif
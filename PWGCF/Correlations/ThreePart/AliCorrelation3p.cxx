@@ -337,6 +337,63 @@ int AliCorrelation3p::Filla(AliVParticle* p1,AliVParticle* p2,const double weigh
   HistFill(GetNumberHist(khPhiEtaa,fMBin,fVzBin),DeltaEta,DeltaPhi, weight);//2p correlation
   return 0;
 }
+int AliCorrelation3p::FillTriplets(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated1, const std::vector<Double_t>& weights1, const std::vector<AliVParticle*>& associated2, const std::vector<Double_t>& weights2, const double weight, bool sameList)
+{
+  /// Same as Fill(ptrigger,p1,p2,weight*w1*w2) for p1 from the first and p2 from the second list,
+  /// in the same order. If sameList, both lists are the same and each pair is filled in both orders,
+  /// as Fill(ptrigger,p1,p2) followed by Fill(ptrigger,p2,p1).
+  /// The trigger dependent quantities are calculated once per associated instead of once per pair.
+  if (!ptrigger) return -EINVAL;
+  std::vector<Double_t> DeltaPhi1,Eta1,DeltaPhi2,Eta2;
+  std::vector<Bool_t> Accepted1,Accepted2;
+  PrepareTriplets(ptrigger,associated1,DeltaPhi1,Eta1,Accepted1);
+  if (!sameList) PrepareTriplets(ptrigger,associated2,DeltaPhi2,Eta2,Accepted2);
+  const std::vector<Double_t>& dphi2 = sameList?DeltaPhi1:DeltaPhi2;
+  const std::vector<Double_t>& eta2  = sameList?Eta1:Eta2;
+  const std::vector<Bool_t>& acc2    = sameList?Accepted1:Accepted2;
+
+  Int_t histn = GetNumberHist(khPhiPhiDEta,fMBin,fVzBin);
+  TH3F* hist = (histn>=0)?dynamic_cast<TH3F*>(fHistograms->At(histn)):NULL;
+  Int_t n1 = associated1.size();
+  Int_t n2 = associated2.size();
+  for (Int_t i=0;i<n1;i++){
+    if (!Accepted1[i]) continue;
+    Double_t weight1 = weight*weights1[i];
+    for (Int_t j=(sameList?i+1:0);j<n2;j++){
+      if (!acc2[j]) continue;
+      Double_t fillweight = weight1*weights2[j];
+      Double_t DeltaEta12 = Eta1[i]-eta2[j];
+      if(TMath::Abs(DeltaPhi1[i]-dphi2[j])<1.0E-10&&TMath::Abs(DeltaEta12)<1.0E-10) continue;//Track duplicate, reject (in both orders).
+      if (hist) hist->Fill(DeltaEta12,DeltaPhi1[i],dphi2[j],fillweight);
+      else HistFill(histn,DeltaEta12,DeltaPhi1[i],dphi2[j],fillweight);
+      if (!sameList) continue;
+      // same pair with the associated particles swapped
+      if (hist) hist->Fill(eta2[j]-Eta1[i],dphi2[j],DeltaPhi1[i],fillweight);
+      else HistFill(histn,eta2[j]-Eta1[i],dphi2[j],DeltaPhi1[i],fillweight);
+    }
+  }
+  return 0;
+}
+void AliCorrelation3p::PrepareTriplets(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated, std::vector<Double_t>& deltaPhi, std::vector<Double_t>& eta, std::vector<Bool_t>& accepted) const
+{
+  /// phi difference to the trigger, eta and trigger related cuts of Fill(trigger,p1,p2) per associated
+  Int_t n = associated.size();
+  deltaPhi.assign(n,0.0);
+  eta.assign(n,0.0);
+  accepted.assign(n,kFALSE);
+  for (Int_t i=0;i<n;i++){
+    AliVParticle* p = associated[i];
+    if (!p) continue;
+    if (ptrigger->Pt()<p->Pt()) continue;
+    Double_t DeltaPhi = ptrigger->Phi() - p->Phi();
+    if (DeltaPhi<-0.5*gkPii) DeltaPhi += 2*gkPii;
+    if (DeltaPhi>1.5*gkPii)  DeltaPhi -= 2*gkPii;
+    deltaPhi[i] = DeltaPhi;
+    eta[i] = p->Eta();
+    if(TMath::Abs(eta[i]-ptrigger->Eta())<1.0E-10) continue;//Track duplicate, reject.
+    accepted[i] = kTRUE;
+  }
+}
 int AliCorrelation3p::FillTrigger(AliVParticle* ptrigger)
 {
   Double_t fillweight = dynamic_cast<AliFilteredTrack*>(ptrigger)->GetEff();    
@@ -18,6 +18,7 @@
 #include "TF1.h"
 #include "TH2D.h"
 #include "TH3D.h"
+#include <vector>
 class TH1;
 class TH1F;
 class TH2F;
@@ -53,6 +54,8 @@ class AliCorrelation3p_noQA : public TNamed {
   int Fill( AliVParticle* trigger		, AliVParticle* p1	, AliVParticle* p2	, const double weight=1.0);
   int Fill( AliVParticle* trigger		, AliVParticle* p1				, const double weight=1.0);
   int Filla( AliVParticle* p1			, AliVParticle* p2				, const double weight=1.0);
+  /// fill the three particle histogram for one trigger and all pairs of associated particles
+  int FillTriplets( AliVParticle* trigger, const std::vector<AliVParticle*>& associated1, const std::vector<Double_t>& weights1, const std::vector<AliVParticle*>& associated2, const std::vector<Double_t>& weights2, const double weight=1.0, bool sameList=false);
   int FillTrigger( AliVParticle*ptrigger);
   int MakeResultsFile(const char* scalingmethod, bool recreate=false, bool all=false);
   /// overloaded from TObject: cleanup
@@ -119,6 +122,7 @@ class AliCorrelation3p_noQA : public TNamed {
   void HistFill(Int_t Histn,Double_t Val1,Double_t Val2);
   void HistFill(Int_t Histn,Double_t Val1,Double_t Val2, Double_t Val_3);
   void HistFill(Int_t Histn,Double_t Val1,Double_t Val2, Double_t Val_3, Double_t weight);
+  void PrepareTriplets(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated, std::vector<Double_t>& deltaPhi, std::vector<Double_t>& eta, std::vector<Bool_t>& accepted) const;
   TH2D * slice(TH3F* hist,const char* option, Int_t firstbin, Int_t lastbin, const char* name="slice", Bool_t baverage = kFALSE) const;
   void AddSlice(TH3F* hist,TH2D* AddTo,const char* option, Int_t firstbin, Int_t lastbin, const char* name="slice", Bool_t baverage = kFALSE) const;
 
@@ -252,31 +252,28 @@ class AliThreeParticleCorrelator : public TNamed {
     /// Fill correlation objects of different properties 
     Double_t NAssociated = associated.size();
     Double_t weightt = 1.0;
-    Double_t weighta1 = 1.0;
-    Double_t weighta2 = 1.0;
     if(NAssociated==0) return 0;//No associated means we need not fill anything.
     if (activeTriggers.size()==0) return 0;//No Triggers means we need not fill anything
+    //Efficiency weights of the associated, once per event instead of once per pair.
+    std::vector<Double_t> weights;
+    MakeWeights(associated,weights);
     for (typename std::vector<AliVParticle*>::const_iterator trigger=activeTriggers.begin(), e=activeTriggers.end(); trigger!=e; ++trigger) {
       AnalysisObject->FillTrigger(*trigger);//Fill histogram for number of triggers.
       weightt = 1.0;
       if(dynamic_cast<AliFilteredTrack*>(*trigger))weightt = dynamic_cast<AliFilteredTrack*>(*trigger)->GetEff();
-      for (typename std::vector<AliVParticle*>::const_iterator assoc=associated.begin(), eassoc=associated.end(); assoc!=eassoc; ++assoc) {
-	weighta1 = 1.0;
-	if(dynamic_cast<AliFilteredTrack*>(*assoc))weighta1 = dynamic_cast<AliFilteredTrack*>(*assoc)->GetEff();
-	for (typename std::vector<AliVParticle*>::const_iterator assoc2=assoc+1, eassoc2 = associated.end(); assoc2 !=eassoc2;++assoc2){
-	  weighta2 = 1.0;
-	  if(dynamic_cast<AliFilteredTrack*>(*assoc2))weighta2 = dynamic_cast<AliFilteredTrack*>(*assoc2)->GetEff();
-	  AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
-	  AnalysisObject->Fill(*trigger,*assoc2,*assoc,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
-	  if(trigger==activeTriggers.begin()){
-	    //once per event fill the a-a 2p correlation histogram symmitrized
-	    AnalysisObject->Filla(*assoc,*assoc2,weighta1*weighta2);
-	    AnalysisObject->Filla(*assoc2,*assoc,weighta1*weighta2);
-	  }
-	}//loop over second associated
-	AnalysisObject->Fill(*trigger,*assoc,weightt*weighta1);//Fill histogram for number of triggers.	        
+      //All pairs of associated, in both orders.
+      AnalysisObject->FillTriplets(*trigger,associated,weights,associated,weights,weightt,true);
+      for (UInt_t iassoc=0; iassoc<associated.size(); iassoc++) {
+	AnalysisObject->Fill(*trigger,associated[iassoc],weightt*weights[iassoc]);//Fill histogram for number of triggers.	        
       } // loop over first associated
     } // loop over triggers
+    //once per event fill the a-a 2p correlation histogram symmitrized
+    for (UInt_t iassoc=0; iassoc<associated.size(); iassoc++) {
+      for (UInt_t iassoc2=iassoc+1; iassoc2<associated.size(); iassoc2++) {
+	AnalysisObject->Filla(associated[iassoc],associated[iassoc2],weights[iassoc]*weights[iassoc2]);
+	AnalysisObject->Filla(associated[iassoc2],associated[iassoc],weights[iassoc]*weights[iassoc2]);
+      }
+    }
     return 0;
   }
   int ProcessEvent(const std::vector<AliVParticle*>& activeTriggers,const std::vector<AliVParticle*>& associated, const std::vector<AliVParticle*>& associatedmixed,C* AnalysisObject,bool twop = true) {
@@ -285,34 +282,41 @@ class AliThreeParticleCorrelator : public TNamed {
     Double_t NAssociated1 = associated.size();
     Double_t NAssociated2 = associatedmixed.size();
     Double_t weightt = 1.0;
-    Double_t weighta1 = 1.0;
-    Double_t weighta2 = 1.0;
     if(NAssociated1==0||NAssociated2==0) return 0;//No associated means we need not fill anything.
     if (activeTriggers.size()==0) return 0;//no triggers means nothing to be correlated
+    //Efficiency weights of the associated, once per event instead of once per pair.
+    std::vector<Double_t> weights1;
+    std::vector<Double_t> weights2;
+    MakeWeights(associated,weights1);
+    MakeWeights(associatedmixed,weights2);
     for (typename std::vector<AliVParticle*>::const_iterator trigger=activeTriggers.begin(), e=activeTriggers.end(); trigger!=e; ++trigger) {
       AnalysisObject->FillTrigger(*trigger);//Fill histogram for number of triggers.
       weightt = 1.0;
       if(dynamic_cast<AliFilteredTrack*>(*trigger))weightt = dynamic_cast<AliFilteredTrack*>(*trigger)->GetEff();
-      for (typename std::vector<AliVParticle*>::const_iterator assoc=associated.begin(), eassoc=associated.end(); assoc!=eassoc; ++assoc) {
-	weighta1 = 1.0;
-	if(dynamic_cast<AliFilteredTrack*>(*assoc))weighta1 = dynamic_cast<AliFilteredTrack*>(*assoc)->GetEff();
-	for (typename std::vector<AliVParticle*>::const_iterator assoc2=associatedmixed.begin(), eassoc2 = associatedmixed.end(); assoc2 !=eassoc2;++assoc2){
-	  weighta2 = 1.0;
-	  if(dynamic_cast<AliFilteredTrack*>(*assoc2))weighta2 = dynamic_cast<AliFilteredTrack*>(*assoc2)->GetEff();
-	  AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
-	  if(trigger==activeTriggers.begin()){
-	    //once per event fill the a-a 2p correlation histogram
-	    AnalysisObject->Filla(*assoc,*assoc2,weighta1*weighta2);
-	    AnalysisObject->Filla(*assoc2,*assoc,weighta1*weighta2);
-	  }
-	}//loop over second associated
-	if (twop){
-	  AnalysisObject->Fill(*trigger,*assoc,weightt*weighta1);//Fill histogram for number of triggers.  
-	  }
+      AnalysisObject->FillTriplets(*trigger,associated,weights1,associatedmixed,weights2,weightt,false);
+      if (twop){
+	for (UInt_t iassoc=0; iassoc<associated.size(); iassoc++) {
+	  AnalysisObject->Fill(*trigger,associated[iassoc],weightt*weights1[iassoc]);//Fill histogram for number of triggers.  
 	} // loop over first associated
+      }
     } // loop over triggers
+    //once per event fill the a-a 2p correlation histogram
+    for (UInt_t iassoc=0; iassoc<associated.size(); iassoc++) {
+      for (UInt_t iassoc2=0; iassoc2<associatedmixed.size(); iassoc2++) {
+	AnalysisObject->Filla(associated[iassoc],associatedmixed[iassoc2],weights1[iassoc]*weights2[iassoc2]);
+	AnalysisObject->Filla(associatedmixed[iassoc2],associated[iassoc],weights1[iassoc]*weights2[iassoc2]);
+      }
+    }
     return 0;
   }
+  void MakeWeights(const std::vector<AliVParticle*>& particles, std::vector<Double_t>& weights) const {
+    /// efficiency weights of the particles, 1 if not available
+    weights.assign(particles.size(),1.0);
+    for (UInt_t i=0; i<particles.size(); i++) {
+      AliFilteredTrack* track=dynamic_cast<AliFilteredTrack*>(particles[i]);
+      if (track) weights[i] = track->GetEff();
+    }
+  }
   
   void MakeTriggers(const TObjArray* arrayParticles,C* fAnalysisObject,bool fLeading,bool makehist=kFALSE) {
     /// create a particle array with reduced data objects
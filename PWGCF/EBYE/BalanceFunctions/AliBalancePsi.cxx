@@ -25,6 +25,7 @@
 #include <TCanvas.h>
 #include <TMath.h>
 #include <TAxis.h>
+#include <TArrayL64.h>
 #include <TH2D.h>
 #include <TH3D.h>
 #include <TLorentzVector.h>
@@ -92,7 +93,8 @@ AliBalancePsi::AliBalancePsi() :
   fVertexBinning(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fCommonPairBinning(-1){
   // Default constructor
 }
 
@@ -138,7 +140,8 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fVertexBinning(balance.fVertexBinning),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fCommonPairBinning(-1){
   //copy constructor
 }
 
@@ -174,6 +177,9 @@ AliBalancePsi::~AliBalancePsi() {
 void AliBalancePsi::InitHistograms() {
   // single particle histograms
 
+  // new pair histograms, their binning is checked again in CalculateBalance
+  fCommonPairBinning = -1;
+
   // global switch disabling the reference 
   // (to avoid "Replacing existing TH1" if several wagons are created in train)
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -462,6 +468,39 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     secondCorrection[i]  = (Double_t)((AliBFBasicParticle*) particlesSecond->At(i))->Correction();   //==========================correction
     if (fSameLabelMCCut) secondLabel[i]  = (Int_t)((AliBFBasicParticle*) particlesSecond->At(i))->GetLabel(); 
   }
+
+  // The pair histograms are filled via their global bin index (AliTHn::FillBin):
+  // the contributions of event class, pT trigger, pT associated and vertex z
+  // are found once per particle (or event) instead of once per pair,
+  // only Delta eta and Delta phi are looked up in the pair loop.
+  // Same bins and same filling order as AliTHn::Fill, so the content is identical.
+  // Offset -1: the particle is outside the pair histogram range (not filled by AliTHn::Fill either)
+  // The axes of the pair histograms are compared once, not for every event
+  if (fCommonPairBinning < 0){
+    fCommonPairBinning = HasCommonPairBinning() ? 1 : 0;
+    if (fCommonPairBinning == 0)
+      AliWarning("Pair histograms with different binning --> filling with AliTHn::Fill");
+  }
+  Bool_t usePairBins = (fCommonPairBinning == 1);
+  TAxis *pairAxis[kTrackVariablesPair];
+  Long64_t pairStride[kTrackVariablesPair];
+  TArrayL64 secondPtBinOffset(jMax);
+  Long64_t vertexZBinOffset = -1;
+  if (usePairBins){
+    Long64_t stride = 1;
+    for (Int_t iVar = kTrackVariablesPair-1; iVar >= 0; iVar--){
+      pairAxis[iVar]   = fHistPN->GetAxis(iVar,0);
+      pairStride[iVar] = stride;
+      stride *= pairAxis[iVar]->GetNbins();
+    }
+    Int_t vertexZBin = pairAxis[5]->FindBin(vertexZ);
+    if (vertexZBin >= 1 && vertexZBin <= pairAxis[5]->GetNbins())
+      vertexZBinOffset = (vertexZBin-1)*pairStride[5];
+    for (Int_t i=0; i<jMax; i++){
+      Int_t ptBin = pairAxis[4]->FindBin((Double_t)secondPt[i]);
+      secondPtBinOffset[i] = (ptBin >= 1 && ptBin <= pairAxis[4]->GetNbins()) ? (ptBin-1)*pairStride[4] : -1;
+    }
+  }
   
   //TLorenzVector implementation for resonances
   TLorentzVector vectorMother, vectorDaughter[2];
@@ -524,6 +563,16 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     //fill single particle histograms
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
+
+    // pair histogram bin offset of the trigger particle (event class, pT trigger, vertex z)
+    Long64_t firstBinOffset = -1;
+    if (usePairBins && vertexZBinOffset >= 0){
+      Int_t classBin = pairAxis[0]->FindBin(trackVariablesSingle[0]);
+      Int_t ptBin    = pairAxis[3]->FindBin((Double_t)firstPt);
+      if (classBin >= 1 && classBin <= pairAxis[0]->GetNbins() &&
+	  ptBin >= 1 && ptBin <= pairAxis[3]->GetNbins())
+	firstBinOffset = (classBin-1)*pairStride[0] + (ptBin-1)*pairStride[3] + vertexZBinOffset;
+    }
     
     // 2nd particle loop
     for(Int_t j = 0; j < jMax; j++) {   
@@ -722,18 +771,51 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 
       }
 
-      if( charge1 > 0 && charge2 < 0)  fHistPN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]); //==========================correction
-      else if( charge1 < 0 && charge2 > 0)  fHistNP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 > 0 && charge2 > 0)  fHistPP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 < 0 && charge2 < 0)  fHistNN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
+      AliTHn *histPair = 0x0;
+      if( charge1 > 0 && charge2 < 0)  histPair = fHistPN;
+      else if( charge1 < 0 && charge2 > 0)  histPair = fHistNP;
+      else if( charge1 > 0 && charge2 > 0)  histPair = fHistPP;
+      else if( charge1 < 0 && charge2 < 0)  histPair = fHistNN;
       else {
 	//AliWarning(Form("Wrong charge combination: charge1 = %d and charge2 = %d",charge,charge2));
 	continue;
       }
+
+      if (!usePairBins){
+	histPair->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]); //==========================correction
+	continue;
+      }
+      if (firstBinOffset < 0 || secondPtBinOffset[j] < 0) continue;
+      Int_t deltaEtaBin = pairAxis[1]->FindBin(trackVariablesPair[1]);
+      if (deltaEtaBin < 1 || deltaEtaBin > pairAxis[1]->GetNbins()) continue;
+      Int_t deltaPhiBin = pairAxis[2]->FindBin(trackVariablesPair[2]);
+      if (deltaPhiBin < 1 || deltaPhiBin > pairAxis[2]->GetNbins()) continue;
+      histPair->FillBin(firstBinOffset + secondPtBinOffset[j] +
+			(deltaEtaBin-1)*pairStride[1] + (deltaPhiBin-1)*pairStride[2],
+			0,firstCorrection*secondCorrection[j]); //==========================correction
     }//end of 2nd particle loop
   }//end of 1st particle loop
 }  
 
+//____________________________________________________________________//
+Bool_t AliBalancePsi::HasCommonPairBinning() const {
+  // Checks that the four pair histograms have the same axes
+  // (always the case for the histograms made in InitHistograms),
+  // required to fill them with bin indices computed from fHistPN
+  AliTHn *histPair[3] = {fHistNP, fHistPP, fHistNN};
+  for (Int_t iHist = 0; iHist < 3; iHist++){
+    if (!histPair[iHist]) return kFALSE;
+    for (Int_t iVar = 0; iVar < kTrackVariablesPair; iVar++){
+      TAxis *axisPN = fHistPN->GetAxis(iVar,0);
+      TAxis *axis   = histPair[iHist]->GetAxis(iVar,0);
+      if (axis->GetNbins() != axisPN->GetNbins()) return kFALSE;
+      for (Int_t iBin = 1; iBin <= axis->GetNbins()+1; iBin++)
+	if (axis->GetBinLowEdge(iBin) != axisPN->GetBinLowEdge(iBin)) return kFALSE;
+    }
+  }
+  return kTRUE;
+}
+
 //____________________________________________________________________//
 TH1D *AliBalancePsi::GetBalanceFunctionHistogram(Int_t iVariableSingle,
 						 Int_t iVariablePair,
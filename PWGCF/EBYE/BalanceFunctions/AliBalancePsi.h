@@ -141,13 +141,13 @@ class AliBalancePsi : public TObject {
   void SetHistNn(AliTHn *gHist) {
     fHistN = gHist; }//fHistN->FillParent(); fHistN->DeleteContainers();}
   void SetHistNpn(AliTHn *gHist) {
-    fHistPN = gHist; }//fHistPN->FillParent(); fHistPN->DeleteContainers();}
+    fHistPN = gHist; fCommonPairBinning = -1; }//fHistPN->FillParent(); fHistPN->DeleteContainers();}
   void SetHistNnp(AliTHn *gHist) {
-    fHistNP = gHist; }//fHistNP->FillParent(); fHistNP->DeleteContainers();}
+    fHistNP = gHist; fCommonPairBinning = -1; }//fHistNP->FillParent(); fHistNP->DeleteContainers();}
   void SetHistNpp(AliTHn *gHist) {
-    fHistPP = gHist; }//fHistPP->FillParent(); fHistPP->DeleteContainers();}
+    fHistPP = gHist; fCommonPairBinning = -1; }//fHistPP->FillParent(); fHistPP->DeleteContainers();}
   void SetHistNnn(AliTHn *gHist) {
-    fHistNN = gHist; }//fHistNN->FillParent(); fHistNN->DeleteContainers();}
+    fHistNN = gHist; fCommonPairBinning = -1; }//fHistNN->FillParent(); fHistNN->DeleteContainers();}
 
   TH1D *GetBalanceFunctionHistogram(Int_t iVariableSingle,
 				    Int_t iVariablePair,
@@ -241,6 +241,7 @@ class AliBalancePsi : public TObject {
   Double_t* GetBinning(const char* configuration, const char* tag, Int_t& nBins);
 
  private:
+  Bool_t    HasCommonPairBinning() const;
   Float_t   GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign); 
 
   Bool_t fShuffle; //shuffled balance function object
@@ -294,9 +295,11 @@ class AliBalancePsi : public TObject {
 
   TString fEventClass;
 
+  Int_t fCommonPairBinning;//! pair histograms with the same axes (see HasCommonPairBinning): -1 not checked yet, 0 no, 1 yes
+
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 3)
+  ClassDef(AliBalancePsi, 4)
 };
 
 #endif
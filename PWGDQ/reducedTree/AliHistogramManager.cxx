@@ -49,7 +49,11 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fPlanClassStart(),
+  fPlanClassEnd(),
+  fPlan(),
+  fPlanVars()
 {
   //
   // Constructor
@@ -71,7 +75,11 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fPlanClassStart(),
+  fPlanClassEnd(),
+  fPlan(),
+  fPlanVars()
 {
   //
   // Constructor
@@ -130,6 +138,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   THashList* hList=new THashList;
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
+  hList->SetUniqueID(fMainList.GetEntries());   // histogram class index, see GetHistClassIndex()
   fMainList.Add(hList);
 }
 
@@ -144,6 +153,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a histogram
   //
+  ClearFillPlans();
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -283,6 +293,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a histogram
   //
+  ClearFillPlans();
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -425,6 +436,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a multi-dimensional histogram THnF or THnFSparseF
   //
+  ClearFillPlans();
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -478,6 +490,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a multi-dimensional histogram THnF or THnSparseF with equal or variable bin widths
   //
+  ClearFillPlans();
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -624,142 +637,165 @@ void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values
     cout << "         Histogram list not filled" << endl; */
     return;
   }
-  if(!hList) {
-    return;
+  FillHistClass(Int_t(hList->GetUniqueID()), values);
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
+  //
+  //  get the index of a histogram class to be used with FillHistClass(Int_t, Float_t*)
+  //  returns -1 if the class does not exist.
+  //  The index is the order in which the class was added and does not change when histograms are
+  //  added later on (the compiled fill plans are invalidated then, but not the class indices)
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  return Int_t(hList->GetUniqueID());
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIdx, Float_t* values) {
+  //
+  //  fill a class of histograms using its compiled fill plan, compiled at the first call
+  //
+  if(classIdx<0) return;
+  if(classIdx>=(Int_t)fPlanClassStart.size() || fPlanClassStart[classIdx]<0)
+    if(!CompileHistClass(classIdx)) return;
+  
+  Double_t fillValues[20]={0.0};
+  for(Int_t i=fPlanClassStart[classIdx]; i<fPlanClassEnd[classIdx]; ++i) {
+    const FillDescriptor& d = fPlan[i];
+    const Int_t* vars = &fPlanVars[d.fFirstVar];
+    Bool_t weighted = (d.fVarW>AliReducedVarManager::kNothing);
+    switch(d.fKind) {
+      case kFillTH1:
+        if(weighted) ((TH1*)d.fHist)->Fill(values[vars[0]],values[d.fVarW]);
+        else         ((TH1*)d.fHist)->Fill(values[vars[0]]);
+        break;
+      case kFillTProfile:
+        if(weighted) ((TProfile*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[d.fVarW]);
+        else         ((TProfile*)d.fHist)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTH2:
+        if(weighted) ((TH2*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[d.fVarW]);
+        else         ((TH2*)d.fHist)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTProfile2D:
+        if(weighted) ((TProfile2D*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[d.fVarW]);
+        else         ((TProfile2D*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTH3:
+        if(weighted) ((TH3*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[d.fVarW]);
+        else         ((TH3*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTProfile3D:
+        if(weighted) ((TProfile3D*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[d.fVarW]);
+        else         ((TProfile3D*)d.fHist)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+        break;
+      case kFillTHn:
+        for(Int_t idim=0;idim<d.fNVars;++idim) fillValues[idim] = values[vars[idim]];
+        if(weighted) ((THnBase*)d.fHist)->Fill(fillValues,values[d.fVarW]);
+        else         ((THnBase*)d.fHist)->Fill(fillValues);
+        break;
+      default:
+        break;
+    }
   }
-    
+}
+
+//__________________________________________________________________
+Bool_t AliHistogramManager::CompileHistClass(Int_t classIdx) {
+  //
+  //  Translate a histogram class into a flat array of fill descriptors (done once per class).
+  //  The histogram type, the variables and the weight are decoded from the UniqueID's of the
+  //  histogram and of its axes. Histograms using variables which are not enabled are skipped.
+  //  Returns kFALSE if the class does not exist
+  //
+  if(classIdx<0 || classIdx>=fMainList.GetEntries()) return kFALSE;
+  THashList* hList = (THashList*)fMainList.At(classIdx);
+  if(!hList) return kFALSE;
+  
+  if((Int_t)fPlanClassStart.size()<fMainList.GetEntries()) {
+    fPlanClassStart.resize(fMainList.GetEntries(), -1);
+    fPlanClassEnd.resize(fMainList.GetEntries(), -1);
+  }
+  fPlanClassStart[classIdx] = fPlan.size();
   TIter next(hList);
   TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
   while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
+    Int_t uid = h->GetUniqueID();
+    Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+    Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
+    Int_t thnDim = 0;
     if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
+    Int_t dimension = 0;
     if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
+    
     uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
+    Int_t varT = -1, varW = -1;
     if(uid>0) {
       varW = uid%(fNVars+1)-1;
       if(varW==0) varW=AliReducedVarManager::kNothing;
       uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
       if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
     }
-        
+    if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) continue;
+    
+    FillDescriptor d;
+    d.fHist = h;
+    d.fFirstVar = fPlanVars.size();
+    d.fVarW = (varW>AliReducedVarManager::kNothing ? varW : -1);
+    Int_t vars[20];
     if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
-          case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
+      vars[0] = ((TH1*)h)->GetXaxis()->GetUniqueID();
+      vars[1] = ((TH1*)h)->GetYaxis()->GetUniqueID();
+      vars[2] = ((TH1*)h)->GetZaxis()->GetUniqueID();
+      vars[3] = varT;
+      switch(dimension) {
+        case 1:
+          d.fKind = (isProfile ? kFillTProfile : kFillTH1);
+          d.fNVars = (isProfile ? 2 : 1);
           break;
-          case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
+        case 2:
+          d.fKind = (isProfile ? kFillTProfile2D : kFillTH2);
+          d.fNVars = (isProfile ? 3 : 2);
           break;
-          case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
+        case 3:
+          d.fKind = (isProfile ? kFillTProfile3D : kFillTH3);
+          d.fNVars = (isProfile ? 4 : 3);
           break;
-          default:
-          break;
-        }  // end switch
+        default:
+          continue;
       }
-    }  // end if(!isTHn)
+    }
     else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        }
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
-      }
+      if(thnDim>20) continue;
+      d.fKind = kFillTHn;
+      d.fNVars = thnDim;
+      for(Int_t idim=0;idim<thnDim;++idim) vars[idim] = ((THnBase*)h)->GetAxis(idim)->GetUniqueID();
     }
+    Bool_t allVarsGood = kTRUE;
+    for(Int_t iv=0; iv<d.fNVars; ++iv) 
+      if(vars[iv]<0 || vars[iv]>=AliReducedVarManager::kNVars || !fUsedVars[vars[iv]]) allVarsGood = kFALSE;
+    if(!allVarsGood) continue;
+    
+    for(Int_t iv=0; iv<d.fNVars; ++iv) fPlanVars.push_back(vars[iv]);
+    fPlan.push_back(d);
   }
+  fPlanClassEnd[classIdx] = fPlan.size();
+  return kTRUE;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::ClearFillPlans() {
+  //
+  //  invalidate the compiled fill plans (e.g. when histograms are added); the histogram class
+  //  indices stay valid, the plans are compiled again at the next fill
+  //
+  fPlanClassStart.clear();
+  fPlanClassEnd.clear();
+  fPlan.clear();
+  fPlanVars.clear();
 }
 
 //__________________________________________________________________
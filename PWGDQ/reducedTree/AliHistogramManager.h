@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +71,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classIdx, Float_t* values);
+  Int_t GetHistClassIndex(const Char_t* className);     // index of a histogram class, for FillHistClass(Int_t, Float_t*); stays valid when histograms are added
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,7 +110,34 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Compiled fill plans: each histogram class is translated, at its first fill, into a flat array of
+  // fill descriptors, such that filling does not need the UniqueID decoding or any string operations.
+  // The plans are indexed by the histogram class index (order of AddHistClass, kept in the UniqueID of the
+  // class THashList) and are recompiled at the next fill after histograms are added
+  enum EFillKind {
+    kFillTH1=0,
+    kFillTProfile,
+    kFillTH2,
+    kFillTProfile2D,
+    kFillTH3,
+    kFillTProfile3D,
+    kFillTHn
+  };
+  struct FillDescriptor {
+    TObject* fHist;        // target histogram
+    Int_t    fKind;        // fill kind, see EFillKind
+    Int_t    fNVars;       // number of variables to fill (THn dimension)
+    Int_t    fFirstVar;    // position of the first variable index in fPlanVars
+    Int_t    fVarW;        // weight variable, -1 if not weighted
+  };
+  std::vector<Int_t>          fPlanClassStart;  //! position of the first descriptor of each histogram class in fPlan, -1 if not compiled
+  std::vector<Int_t>          fPlanClassEnd;    //! position after the last descriptor of each histogram class in fPlan
+  std::vector<FillDescriptor> fPlan;            //! fill descriptors
+  std::vector<Int_t>          fPlanVars;        //! variable indices of the fill descriptors
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  Bool_t CompileHistClass(Int_t classIdx);
+  void ClearFillPlans();
   
   ClassDef(AliHistogramManager, 4)
 };
@@ -212,23 +212,27 @@ void AliReducedAnalysisFilterTrees::WriteFilteredPairs() {
    // loop over the pair list in the unfiltered event and evaluate all the pair cuts
    AliReducedPairInfo* pair = 0x0;
    TClonesArray* pairList = fEvent->GetPairs();
+   // histogram classes filled for every pair, looked up once
+   Int_t pairIdx = fHistosManager->GetHistClassIndex("Pair_BeforeCuts");
+   Int_t pairQualityFlagsIdx = fHistosManager->GetHistClassIndex("PairQualityFlags_BeforeCuts");
    TIter nextPair(pairList);
    for(Int_t ip=0; ip<fEvent->NPairs(); ++ip) {
       pair = (AliReducedPairInfo*)nextPair();
       AliReducedVarManager::FillPairInfo(pair, fValues);
-      fHistosManager->FillHistClass("Pair_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(pairIdx, fValues);
       for(UShort_t iflag=0; iflag<32; ++iflag) {
          AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
-         fHistosManager->FillHistClass("PairQualityFlags_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(pairQualityFlagsIdx, fValues);
       }
       
       if(IsPairSelected(pair, fValues)) {
          for(Int_t icut=0; icut<fPairCuts.GetEntries(); ++icut) {
             if(pair->TestFlag(icut)) {
                fHistosManager->FillHistClass(Form("Pair_%s", fPairCuts.At(icut)->GetName()), fValues);
+               Int_t cutQualityFlagsIdx = fHistosManager->GetHistClassIndex(Form("PairQualityFlags_%s", fPairCuts.At(icut)->GetName()));
                for(UShort_t iflag=0; iflag<32; ++iflag) {
                   AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
-                  fHistosManager->FillHistClass(Form("PairQualityFlags_%s", fPairCuts.At(icut)->GetName()), fValues);
+                  fHistosManager->FillHistClass(cutQualityFlagsIdx, fValues);
                }
             }
          }
@@ -248,12 +252,13 @@ void AliReducedAnalysisFilterTrees::WriteFilteredTracks() {
    // loop over the track list and evaluate all the track cuts
    AliReducedBaseTrack* track = 0x0;
    TClonesArray* trackList = fEvent->GetTracks();
+   Int_t trackIdx = fHistosManager->GetHistClassIndex("Track_BeforeCuts");   // filled for every track, looked up once
    TIter nextTrack(trackList);
    // for(Int_t it=0; it<fEvent->NTracks(); ++it) {
    for(Int_t it=0; it<trackList->GetEntries(); ++it) {
       track = (AliReducedBaseTrack*)nextTrack();
       AliReducedVarManager::FillTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(trackIdx, fValues);
       
       Bool_t writeTrack = IsTrackSelected(track, fValues);
       writeTrack |= TrackIsCandidateLeg(track);
@@ -310,6 +315,9 @@ void AliReducedAnalysisFilterTrees::RunCandidateLegsSelection() {
    // loop over the track list and evaluate all the track cuts
    AliReducedBaseTrack* track = 0x0;
    TClonesArray* trackList = fEvent->GetTracks();
+   // prefilter track histogram classes, looked up once
+   Int_t leg1PrefilterIdx = fHistosManager->GetHistClassIndex("Track_LEG1_PrefilterTrack");
+   Int_t leg2PrefilterIdx = fHistosManager->GetHistClassIndex("Track_LEG2_PrefilterTrack");
    TIter nextTrack(trackList);
    // for(Int_t it=0; it<fEvent->NTracks(); ++it) {
    for(Int_t it=0; it<trackList->GetEntries(); ++it) {
@@ -344,22 +352,22 @@ void AliReducedAnalysisFilterTrees::RunCandidateLegsSelection() {
       if(isAsymmetricDecayChannel) {
          if(IsCandidateLegPrefilterSelected(track, fValues, 1)) {
             fLeg1PrefilteredTracks.Add(track);
-            fHistosManager->FillHistClass("Track_LEG1_PrefilterTrack", fValues);
+            fHistosManager->FillHistClass(leg1PrefilterIdx, fValues);
          }
          if(IsCandidateLegPrefilterSelected(track, fValues, 2)) {
             fLeg2PrefilteredTracks.Add(track);
-            fHistosManager->FillHistClass("Track_LEG2_PrefilterTrack", fValues);
+            fHistosManager->FillHistClass(leg2PrefilterIdx, fValues);
          }
       }
       else {
          if(IsCandidateLegPrefilterSelected(track, fValues)) {
             if(track->Charge()>0) {
                fLeg1PrefilteredTracks.Add(track);
-               fHistosManager->FillHistClass("Track_LEG1_PrefilterTrack", fValues);
+               fHistosManager->FillHistClass(leg1PrefilterIdx, fValues);
             }
             if(track->Charge()<0) {
                fLeg2PrefilteredTracks.Add(track);
-               fHistosManager->FillHistClass("Track_LEG2_PrefilterTrack", fValues);
+               fHistosManager->FillHistClass(leg2PrefilterIdx, fValues);
             }
          }
       }
@@ -381,9 +381,15 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
          AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
          if(!trackInfo) continue;
          
+         // look up the histogram classes once, not for every flag and layer
+         Int_t statusFlagsIdx = fHistosManager->GetHistClassIndex(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()));
+         Int_t itsClusterMapIdx = fHistosManager->GetHistClassIndex(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()));
+         Int_t itsSharedClusterMapIdx = fHistosManager->GetHistClassIndex(Form("%sITSsharedClusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()));
+         Int_t tpcClusterMapIdx = fHistosManager->GetHistClassIndex(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()));
+         
          for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
             AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(statusFlagsIdx, fValues);
             if(mcDecisionMap) {
                for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
                   if(mcDecisionMap & (UInt_t(1)<<iMC))
@@ -394,7 +400,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
          }
          for(Int_t iLayer=0; iLayer<6; ++iLayer) {
             AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(itsClusterMapIdx, fValues);
             if(mcDecisionMap) {
                for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
                   if(mcDecisionMap & (UInt_t(1)<<iMC))
@@ -403,7 +409,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
                }
             }
             AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(itsSharedClusterMapIdx, fValues);
             if(mcDecisionMap) {
                for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
                   if(mcDecisionMap & (UInt_t(1)<<iMC))
@@ -414,7 +420,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
          }
          for(Int_t iLayer=0; iLayer<8; ++iLayer) {
             AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(tpcClusterMapIdx, fValues);
             if(mcDecisionMap) {
                for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
                   if(mcDecisionMap & (UInt_t(1)<<iMC))
@@ -471,6 +477,13 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
    TClonesArray* trackList = (arrayOption==1 ? fEvent->GetTracks() : fEvent->GetTracks2());
    if (!trackList) return;
 
+   // histogram classes filled for every track, looked up once
+   Int_t trackIdx = fHistosManager->GetHistClassIndex("Track_BeforeCuts");
+   Int_t statusFlagsIdx = fHistosManager->GetHistClassIndex("TrackStatusFlags_BeforeCuts");
+   Int_t itsClusterMapIdx = fHistosManager->GetHistClassIndex("TrackITSclusterMap_BeforeCuts");
+   Int_t itsSharedClusterMapIdx = fHistosManager->GetHistClassIndex("TrackITSsharedClusterMap_BeforeCuts");
+   Int_t tpcClusterMapIdx = fHistosManager->GetHistClassIndex("TrackTPCclusterMap_BeforeCuts");
+
    TIter nextTrack(trackList);
    for(Int_t it=0; it<trackList->GetEntries(); ++it) {
       track = (AliReducedBaseTrack*)nextTrack();
@@ -481,24 +494,24 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
       for(Int_t i=AliReducedVarManager::kNEventVars; i<AliReducedVarManager::kEMCALmatchedEOverP; ++i) fValues[i]=-9999.;
 
       AliReducedVarManager::FillTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(trackIdx, fValues);
       
       if(track->IsA() == AliReducedTrackInfo::Class()) {
          AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
          if(trackInfo) {
             for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
                AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-               fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(statusFlagsIdx, fValues);
             }
             for(Int_t iLayer=0; iLayer<6; ++iLayer) {
                AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(itsClusterMapIdx, fValues);
                AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSsharedClusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(itsSharedClusterMapIdx, fValues);
             }
             for(Int_t iLayer=0; iLayer<8; ++iLayer) {
                AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(tpcClusterMapIdx, fValues);
             }
          }
       }
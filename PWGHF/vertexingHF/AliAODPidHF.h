@@ -109,6 +109,7 @@ public:
   void SetPtThresholdTPC(Double_t ptThresholdTPC){fPtThresholdTPC=ptThresholdTPC;return;}
   void SetMaxTrackMomForCombinedPID(Double_t mom){fMaxTrackMomForCombinedPID=mom;}
   void SetPidResponse(AliPIDResponse *pidResp) {fPidResponse=pidResp;return;}
+  void SetUseSharedCache(Bool_t flag) {fUseSharedCache=flag;}
   void SetCombDetectors(ECombDetectors pidComb) {
     fCombDetectors=pidComb;
   }
@@ -158,6 +159,7 @@ public:
   Double_t GetPtThresholdTPC(){return fPtThresholdTPC;}
   Double_t GetMaxTrackMomForCombinedPID(){return fMaxTrackMomForCombinedPID;}
   AliPIDResponse *GetPidResponse() const {return fPidResponse;}
+  Bool_t GetUseSharedCache() const {return fUseSharedCache;}
   AliPIDCombined *GetPidCombined() const {return fPidCombined;}
   ECombDetectors GetCombDetectors() const {
     return fCombDetectors;
@@ -283,6 +285,7 @@ private:
   ECombDetectors fCombDetectors; /// detectors to be involved for combined PID
   Bool_t fUseCombined; /// detectors to be involved for combined PID
   Bool_t fDefaultPriors; /// use default priors for combined PID
+  Bool_t fUseSharedCache; //!<! take TPC and TOF n-sigmas from AliHFSelectionCache (set by AliRDHFCuts)
 
   /// Storage of identification/compatibility band for different species and detectors:
   TF1 *fIdBandMin[AliPID::kSPECIES][4];
@@ -291,7 +294,7 @@ private:
   TF1 *fCompBandMax[AliPID::kSPECIES][4];
 
   /// \cond CLASSIMP
-  ClassDef(AliAODPidHF,24); /// AliAODPid for heavy flavor PID
+  ClassDef(AliAODPidHF,25); /// AliAODPid for heavy flavor PID
   /// \endcond
 
 };
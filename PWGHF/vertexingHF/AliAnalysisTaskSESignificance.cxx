@@ -79,6 +79,8 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance():
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fFillTightestCell(kFALSE),
+  fCellsIntegrated(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(0),
   fPDGmother(0),
@@ -119,6 +121,8 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance(const char *name, T
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fFillTightestCell(kFALSE),
+  fCellsIntegrated(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(decaychannel),
   fPDGmother(0),
@@ -620,8 +624,9 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
       TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
       AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
 
-      ULong64_t *addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
-      if(fDebug>1)printf("nvals = %d\n",nVals);
+      Int_t nPassed=0;
+      ULong64_t *addresses = GetCellsToFill(muvec,(Float_t)d->Pt(),nVals,nPassed);
+      if(fDebug>1)printf("nvals = %d\n",nPassed);
       for(Int_t ivals=0;ivals<nVals;ivals++){
 	if(addresses[ivals]>=muvec->GetNTotCells()){
 	  if (fDebug>1) printf("Overflow!!\n");
@@ -629,7 +634,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	  return;
 	}
 	
-	fHistNEvents->Fill(3);
+	if(fFillTightestCell) fHistNEvents->Fill(3,nPassed);
+	else fHistNEvents->Fill(3);
 	
 	//fill the histograms with the appropriate method
 	switch (fDecChannel){
@@ -664,8 +670,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	nVals=0;
 	fRDCuts->GetCutVarsForOpt(d,fVars,fNVars,fPDGdaughters,aod);
 	delete [] addresses;
-	addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
-	if(fDebug>1)printf("nvals = %d\n",nVals);
+	addresses = GetCellsToFill(muvec,(Float_t)d->Pt(),nVals,nPassed);
+	if(fDebug>1)printf("nvals = %d\n",nPassed);
 	for(Int_t ivals=0;ivals<nVals;ivals++){
 	  if(addresses[ivals]>=muvec->GetNTotCells()){
 	    if (fDebug>1) printf("Overflow!!\n");
@@ -688,10 +694,65 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskSESignificance::FinishTaskOutput()
+{
+  // With fFillTightestCell each candidate was filled only in the histograms of
+  // the tightest cell it passes: integrate now over the looser cuts so that
+  // each histogram contains all the candidates passing its cuts, as when filling
+  // all the cells. The integration is linear, the outputs can be merged as usual.
+
+  if(!fFillTightestCell || fCellsIntegrated) return;
+  IntegrateOverCuts(fMassHist);
+  if(fReadMC){
+    IntegrateOverCuts(fSigHist);
+    IntegrateOverCuts(fBkgHist);
+    IntegrateOverCuts(fRflHist);
+  }
+  fCellsIntegrated=kTRUE;
+}
+
 //***************************************************************************
 
 // Methods used in the UserExec
 
+//________________________________________________________________________
+ULong64_t* AliAnalysisTaskSESignificance::GetCellsToFill(const AliMultiDimVector* muvec,Float_t pt,Int_t& nVals,Int_t& nPassed) const {
+  // global addresses of the cells to be filled for the candidate with cut variables fVars:
+  // all the cells passing the cuts, or only the tightest one with fFillTightestCell.
+  // nPassed is the number of cells passing the cuts in both cases
+
+  if(!fFillTightestCell){
+    ULong64_t *addresses = muvec->GetGlobalAddressesAboveCuts(fVars,pt,nVals);
+    nPassed=nVals;
+    return addresses;
+  }
+  ULong64_t *addresses = new ULong64_t[1];
+  addresses[0]=muvec->GetGlobalAddressOfTightestCell(fVars,pt,nPassed);
+  nVals=(nPassed>0) ? 1 : 0;
+  return addresses;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskSESignificance::IntegrateOverCuts(TH1F **hist){
+  // cumulative sum of the histograms towards the loose cuts, one cut variable at a time
+  // (see AliMultiDimVector::Integrate)
+
+  Int_t nHistpermv=((AliMultiDimVector*)fCutList->FindObject("multiDimVectorPtBin0"))->GetNTotCells();
+  for(Int_t ptbin=0;ptbin<fNPtBins;ptbin++){
+    AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(Form("multiDimVectorPtBin%d",ptbin));
+    if(!muvec) continue;
+    ULong64_t nCells=muvec->GetNTotCells();
+    TH1F **histPt=hist+ptbin*nHistpermv;
+    for(Int_t iVar=0;iVar<muvec->GetNVariables();iVar++){
+      for(ULong64_t i=nCells; i-->0;){
+	ULong64_t tighter=muvec->GetGlobalAddressOfTighterCell(i,iVar);
+	if(tighter<nCells && histPt[i] && histPt[tighter]) histPt[i]->Add(histPt[tighter]);
+      }
+    }
+  }
+}
+
 
 //********************************************************************************************
 
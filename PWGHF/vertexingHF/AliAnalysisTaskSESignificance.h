@@ -46,6 +46,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void SetDsChannel(Int_t chan){fDsChannel=chan;}
   void SetUseSelBit(Bool_t selBit=kTRUE){fUseSelBit=selBit;}
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
+  void SetFillTightestCellOnly(Bool_t flag=kTRUE) {fFillTightestCell=flag;}
 
   //void SetMultiVector(const AliMultiDimVector *MultiDimVec){fMultiDimVec->CopyStructure(MultiDimVec);}
   Float_t GetUpperMassLimit()const {return fUpmasslimit;}
@@ -55,11 +56,13 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBFeedDown()const {return fBFeedDown;}
   Int_t GetDsChannel()const {return fDsChannel;}
   Bool_t GetUseSelBit()const {return fUseSelBit;}
+  Bool_t GetFillTightestCellOnly()const {return fFillTightestCell;}
 
   /// Implementation of interface methods
   virtual void UserCreateOutputObjects();
   virtual void LocalInit();// {Init();}
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *option);
     
  private:
@@ -92,6 +95,8 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void FillDstar(AliAODRecoCascadeHF* dstarD0pi,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillD04p(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillLambdac(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index, Int_t isSel);
+  ULong64_t* GetCellsToFill(const AliMultiDimVector* muvec,Float_t pt,Int_t& nVals,Int_t& nPassed) const;
+  void IntegrateOverCuts(TH1F **hist);
 
 
   enum {kMaxPtBins=8};
@@ -115,6 +120,8 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
                          /// -1: no protection,  0: check AOD/dAOD nEvents only,  1: check AOD/dAOD nEvents + TProcessID names
   Bool_t fReadMC;    /// flag for access to MC
   Bool_t fUseSelBit;    /// flag to use selection bit (speed up candidates selection)
+  Bool_t fFillTightestCell; /// flag to fill only the tightest cell passed by each candidate, histograms integrated over the cuts in FinishTaskOutput
+  Bool_t fCellsIntegrated;  //!<! histograms already integrated over the cuts
   FeedDownEnum fBFeedDown; /// flag to search for D from B decays
   Int_t fDecChannel; /// decay channel identifier
   Int_t fPDGmother;  /// PDG code of D meson
@@ -131,7 +138,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t fPDGD0ToKpi[2];    /// PDG codes for the particles in the D0 -> K + pi decay
 
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSESignificance,6); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
+  ClassDef(AliAnalysisTaskSESignificance,7); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
   /// \endcond
 };
 
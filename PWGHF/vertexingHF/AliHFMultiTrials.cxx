@@ -22,6 +22,12 @@
 #include <TF1.h>
 #include <TLatex.h>
 #include <TFile.h>
+#include <TVectorD.h>
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+#include <ROOT/TProcessExecutor.hxx>
+#include <ROOT/TSeq.hxx>
+#endif
 #include "AliHFMassFitter.h"
 #include "AliHFMassFitterVAR.h"
 #include "AliHFMultiTrials.h"
@@ -90,6 +96,7 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fNtupleMultiTrials(0x0),
   fMinYieldGlob(0),
   fMaxYieldGlob(0),
+  fNWorkers(1),
   fMassFitters()
 {
   // constructor
@@ -193,27 +200,29 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   Bool_t hOK=CreateHistos();
   if(!hOK) return kFALSE;
 
-  Int_t itrial=0;
-  Int_t types=0;
-  Int_t itrialBC=0;
   Int_t totTrials=fNumOfRebinSteps*fNumOfFirstBinSteps*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
 
   fMinYieldGlob=999999.;
   fMaxYieldGlob=0.;
-  Float_t xnt[15];
 
+  // rebinned histograms: created once and shared by all the trials
+  // with the same rebin and first bin
+  std::vector<TH1F*> hRebinned(fNumOfRebinSteps*fNumOfFirstBinSteps,0x0);
+  for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
+    for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
+      Int_t iReb=ir*fNumOfFirstBinSteps+iFirstBin-1;
+      if(fNumOfFirstBinSteps==1) hRebinned[iReb]=RebinHisto(hInvMassHisto,fRebinSteps[ir],-1);
+      else hRebinned[iReb]=RebinHisto(hInvMassHisto,fRebinSteps[ir],iFirstBin);
+    }
+  }
+
+  // list of trials, in the order in which they are stored in the output
+  std::vector<TrialConfig> trials;
+  Int_t itrial=0;
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
-    Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
-      TH1F* hRebinned=0x0;
-      if(fNumOfFirstBinSteps==1) hRebinned=RebinHisto(hInvMassHisto,rebin,-1);
-      else hRebinned=RebinHisto(hInvMassHisto,rebin,iFirstBin);
       for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
-        Double_t minMassForFit=fLowLimFitSteps[iMinMass];
-        Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
         for(Int_t iMaxMass=0; iMaxMass<fNumOfUpLimFitSteps; iMaxMass++){
-          Double_t maxMassForFit=fUpLimFitSteps[iMaxMass];
-          Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
           ++itrial;
           for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
             if(typeb==kExpoBkg && !fUseExpoBkg) continue;
@@ -231,219 +240,307 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
               if (igs==kFreeSigFreeMean  && !fUseFreeS) continue;
               if (igs==kFixSigFreeMean  && !fUseFixSigFreeMean) continue;
               if (igs==kFixSigFixMean   && !fUseFixSigFixMean) continue;
-              Int_t theCase=igs*kNBkgFuncCases+typeb;
-              Int_t globBin=itrial+theCase*totTrials;
-              for(Int_t j=0; j<15; j++) xnt[j]=0.;
-
-              Bool_t mustDeleteFitter = kTRUE;
-              AliHFMassFitterVAR*  fitter=0x0;
-              //if D0 Reflection
-              if(fhTemplRefl){
-                fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
-                fitter->SetTemplateReflections(fhTemplRefl);
-                fitter->SetFixReflOverS(fFixRefloS,kTRUE);
-              }
-              else {
-                if(typeb<=kPol2Bkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,typeb,types);
-                }else if(typeb==kPowBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,4,types);
-                }else if(typeb==kPowTimesExpoBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,5,types);
-                }else{
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,6,types);
-                  if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
-                  if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
-                  if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
-                }
-                fitter->SetReflectionSigmaFactor(0);
-              }
-              if(fFitOption==0) {
-                fitter->SetUseLikelihoodFit();
-                Printf("Using likelihood fit");
-              }
-              else if(fFitOption==1) {
-                fitter->SetUseChi2Fit();
-                Printf("Using chi2 fit");
-              }
-              else if (fFitOption==2) {
-                fitter->SetUseLikelihoodWithWeightsFit();
-                Printf("Using likelihood fit with weights");
-              }
-              fitter->SetInitialGaussianMean(fMassD);
-              fitter->SetInitialGaussianSigma(fSigmaGausMC);
-              xnt[0]=rebin;
-              xnt[1]=iFirstBin;
-              xnt[2]=minMassForFit;
-              xnt[3]=maxMassForFit;
-              xnt[4]=typeb;
-              xnt[6]=0;
-              if(igs==kFixSigFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                xnt[5]=1;
-              }else if(igs==kFixSigUpFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
-                xnt[5]=2;
-              }else if(igs==kFixSigDownFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
-                xnt[5]=3;
-              }else if(igs==kFreeSigFreeMean){
-                xnt[5]=0;
-              }else if(igs==kFixSigFixMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=1;
-                xnt[6]=1;
-              }else if(igs==kFreeSigFixMean){
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=0;
-                xnt[6]=1;
-              }
-              Bool_t out=kFALSE;
-              Double_t chisq=-1.;
-              Double_t sigma=0.;
-              Double_t esigma=0.;
-              Double_t pos=.0;
-              Double_t epos=.0;
-              Double_t ry=.0;
-              Double_t ery=.0;
-              Double_t significance=0.;
-              Double_t erSignif=0.;
-              Double_t bkg=0.;
-              Double_t erbkg=0.;
-              Double_t bkgBEdge=0;
-              Double_t erbkgBEdge=0;
-              TF1* fB1=0x0;
-              if(typeb<kNBkgFuncCases){
-                printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs);
-                out=fitter->MassFitter(0);
-                chisq=fitter->GetReducedChiSquare();
-                fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
-                sigma=fitter->GetSigma();
-                pos=fitter->GetMean();
-                esigma=fitter->GetSigmaUncertainty();
-                if(esigma<0.00001) esigma=0.0001;
-                epos=fitter->GetMeanUncertainty();
-                if(epos<0.00001) epos=0.0001;
-                ry=fitter->GetRawYield();
-                ery=fitter->GetRawYieldError();
-                fB1=fitter->GetBackgroundFullRangeFunc();
-                fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
-                Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
-                Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
-                fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
-                if(out && fDrawIndividualFits && thePad){
-                  thePad->Clear();
-                  fitter->DrawHere(thePad, fnSigmaForBkgEval);
-                  fMassFitters.push_back(fitter);
-                  mustDeleteFitter = kFALSE;
-                  for (auto format : fInvMassFitSaveAsFormats) {
-                    thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
-                  }
-                }
-              }
-              // else{
-              //   out=DoFitWithPol3Bkg(hRebinned,hmin,hmax,igs);
-              //   if(out && thePad){
-              // 	thePad->Clear();
-              // 	hRebinned->Draw();
-              // 	TF1* fSB=(TF1*)hRebinned->GetListOfFunctions()->FindObject("fSB");
-              // 	fB1=new TF1("fB1","[0]+[1]*x+[2]*x*x+[3]*x*x*x",hmin,hmax);
-              // 	for(Int_t j=0; j<4; j++) fB1->SetParameter(j,fSB->GetParameter(3+j));
-              // 	fB1->SetLineColor(2);
-              // 	fB1->Draw("same");
-              // 	fSB->SetLineColor(4);
-              // 	fSB->Draw("same");
-              // 	thePad->Update();
-              // 	chisq=fSB->GetChisquare()/fSB->GetNDF();;
-              // 	sigma=fSB->GetParameter(2);
-              // 	esigma=fSB->GetParError(2);
-              // 	if(esigma<0.00001) esigma=0.0001;
-              // 	pos=fSB->GetParameter(1);
-              // 	epos=fSB->GetParError(1);
-              // 	if(epos<0.00001) epos=0.0001;
-              // 	ry=fSB->GetParameter(0)/hRebinned->GetBinWidth(1);
-              // 	ery=fSB->GetParError(0)/hRebinned->GetBinWidth(1);
-              //   }
-              // }
-              xnt[7]=chisq;
-              if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
-                xnt[8]=significance;
-                xnt[9]=pos;
-                xnt[10]=epos;
-                xnt[11]=sigma;
-                xnt[12]=esigma;
-                xnt[13]=ry;
-                xnt[14]=ery;
-                fHistoRawYieldDistAll->Fill(ry);
-                fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
-                fHistoRawYieldTrialAll->SetBinError(globBin,ery);
-                fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
-                fHistoSigmaTrialAll->SetBinError(globBin,esigma);
-                fHistoMeanTrialAll->SetBinContent(globBin,pos);
-                fHistoMeanTrialAll->SetBinError(globBin,epos);
-                fHistoChi2TrialAll->SetBinContent(globBin,chisq);
-                fHistoChi2TrialAll->SetBinError(globBin,0.00001);
-                fHistoSignifTrialAll->SetBinContent(globBin,significance);
-                fHistoSignifTrialAll->SetBinError(globBin,erSignif);
-                if(fSaveBkgVal) {
-                  fHistoBkgTrialAll->SetBinContent(globBin,bkg);
-                  fHistoBkgTrialAll->SetBinError(globBin,erbkg);
-                  fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
-                  fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
-                }
-
-                if(ry<fMinYieldGlob) fMinYieldGlob=ry;
-                if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
-                fHistoRawYieldDist[theCase]->Fill(ry);
-                fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
-                fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
-                fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
-                fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
-                fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
-                fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
-                fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
-                fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
-                fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
-                fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
-                if(fSaveBkgVal) {
-                  fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
-                  fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
-                }
-
-                for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
-                  Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
-                  Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
-                  if(minMassBC>minMassForFit &&
-                      maxMassBC<maxMassForFit &&
-                      minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
-                      maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
-                    Double_t cnts,ecnts;
-                    BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,cnts,ecnts);
-                    ++itrialBC;
-                    fHistoRawYieldDistBinCAll->Fill(cnts);
-                    fHistoRawYieldTrialBinCAll->SetBinContent(globBin,iStepBC+1,cnts);
-                    fHistoRawYieldTrialBinCAll->SetBinError(globBin,iStepBC+1,ecnts);
-                    fHistoRawYieldTrialBinC[theCase]->SetBinContent(itrial,iStepBC+1,cnts);
-                    fHistoRawYieldTrialBinC[theCase]->SetBinError(itrial,iStepBC+1,ecnts);
-                    fHistoRawYieldDistBinC[theCase]->Fill(cnts);
-                  }
-                }
-              }
-              if (mustDeleteFitter) delete fitter;
-              fNtupleMultiTrials->Fill(xnt);
+              TrialConfig trial;
+              trial.fRebinIndex=ir;
+              trial.fFirstBin=iFirstBin;
+              trial.fMinMassIndex=iMinMass;
+              trial.fMaxMassIndex=iMaxMass;
+              trial.fBkgFunc=typeb;
+              trial.fFitConf=igs;
+              trial.fTrial=itrial;
+              trial.fGlobBin=itrial+(igs*kNBkgFuncCases+typeb)*totTrials;
+              trials.push_back(trial);
             }
           }
         }
       }
-      delete hRebinned;
     }
   }
+
+  // fits
+  Int_t nTrials=trials.size();
+  Int_t nResults=GetNTrialResults();
+  std::vector<Double_t> results(nTrials*nResults,0.);
+  std::vector<Bool_t> done(nTrials,kFALSE);
+  Bool_t drawFits=(fDrawIndividualFits && thePad);
+  if(fNWorkers>1 && nTrials>1 && !drawFits){
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+    // the fits use the global Minuit instance: the trials are distributed over
+    // forked processes, each with its own fitters, and put back in trial order
+    Printf("Running %d trials in %d processes",nTrials,fNWorkers);
+    ROOT::TProcessExecutor pool(fNWorkers);
+    auto fitTrial=[&](Int_t i) {
+      TVectorD* res=new TVectorD(nResults+1);
+      (*res)[0]=i;
+      Int_t iReb=trials[i].fRebinIndex*fNumOfFirstBinSteps+trials[i].fFirstBin-1;
+      DoFitTrial(trials[i],hRebinned[iReb],hInvMassHisto,0x0,res->GetMatrixArray()+1);
+      return res;
+    };
+    std::vector<TVectorD*> poolResults=pool.Map(fitTrial,ROOT::TSeqI(nTrials));
+    for(UInt_t j=0; j<poolResults.size(); j++){
+      if(!poolResults[j]) continue;
+      Int_t i=TMath::Nint((*poolResults[j])[0]);
+      if(i>=0 && i<nTrials){
+        for(Int_t k=0; k<nResults; k++) results[i*nResults+k]=(*poolResults[j])[k+1];
+        done[i]=kTRUE;
+      }
+      delete poolResults[j];
+    }
+#else
+    Printf("AliHFMultiTrials: fits in parallel processes need ROOT >= 6.10, running %d trials sequentially",nTrials);
+#endif
+  }
+  for(Int_t i=0; i<nTrials; i++){
+    if(done[i]) continue;
+    Int_t iReb=trials[i].fRebinIndex*fNumOfFirstBinSteps+trials[i].fFirstBin-1;
+    DoFitTrial(trials[i],hRebinned[iReb],hInvMassHisto,thePad,&results[i*nResults]);
+  }
+
+  // output histograms and ntuple, filled in trial order
+  for(Int_t i=0; i<nTrials; i++) FillTrialResults(trials[i],&results[i*nResults]);
+
+  for(UInt_t iReb=0; iReb<hRebinned.size(); iReb++) delete hRebinned[iReb];
   return kTRUE;
 }
 
+//________________________________________________________________________
+void AliHFMultiTrials::DoFitTrial(const TrialConfig& trial, TH1F* hRebinned, TH1D* hInvMassHisto, TPad* thePad, Double_t* res){
+  // performs the fit of one trial and stores the results in res
+  // (kNTrialResults values + 3 per bin counting step, see FillTrialResults)
+
+  Int_t types=0;
+  Int_t rebin=fRebinSteps[trial.fRebinIndex];
+  Int_t iFirstBin=trial.fFirstBin;
+  Int_t typeb=trial.fBkgFunc;
+  Int_t igs=trial.fFitConf;
+  Double_t minMassForFit=fLowLimFitSteps[trial.fMinMassIndex];
+  Double_t maxMassForFit=fUpLimFitSteps[trial.fMaxMassIndex];
+  Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
+  Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
+  for(Int_t j=0; j<GetNTrialResults(); j++) res[j]=0.;
+
+  Bool_t mustDeleteFitter = kTRUE;
+  AliHFMassFitterVAR*  fitter=0x0;
+  //if D0 Reflection
+  if(fhTemplRefl){
+    fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
+    fitter->SetTemplateReflections(fhTemplRefl);
+    fitter->SetFixReflOverS(fFixRefloS,kTRUE);
+  }
+  else {
+    if(typeb<=kPol2Bkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,typeb,types);
+    }else if(typeb==kPowBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,4,types);
+    }else if(typeb==kPowTimesExpoBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,5,types);
+    }else{
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,6,types);
+      if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
+      if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
+      if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
+    }
+    fitter->SetReflectionSigmaFactor(0);
+  }
+  if(fFitOption==0) {
+    fitter->SetUseLikelihoodFit();
+    Printf("Using likelihood fit");
+  }
+  else if(fFitOption==1) {
+    fitter->SetUseChi2Fit();
+    Printf("Using chi2 fit");
+  }
+  else if (fFitOption==2) {
+    fitter->SetUseLikelihoodWithWeightsFit();
+    Printf("Using likelihood fit with weights");
+  }
+  fitter->SetInitialGaussianMean(fMassD);
+  fitter->SetInitialGaussianSigma(fSigmaGausMC);
+  if(igs==kFixSigFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+  }else if(igs==kFixSigUpFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
+  }else if(igs==kFixSigDownFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
+  }else if(igs==kFixSigFixMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+  }else if(igs==kFreeSigFixMean){
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+  }
+  Bool_t out=kFALSE;
+  Double_t chisq=-1.;
+  Double_t sigma=0.;
+  Double_t esigma=0.;
+  Double_t pos=.0;
+  Double_t epos=.0;
+  Double_t ry=.0;
+  Double_t ery=.0;
+  Double_t significance=0.;
+  Double_t erSignif=0.;
+  Double_t bkg=0.;
+  Double_t erbkg=0.;
+  Double_t bkgBEdge=0;
+  Double_t erbkgBEdge=0;
+  TF1* fB1=0x0;
+  if(typeb<kNBkgFuncCases){
+    printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs);
+    out=fitter->MassFitter(0);
+    chisq=fitter->GetReducedChiSquare();
+    fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
+    sigma=fitter->GetSigma();
+    pos=fitter->GetMean();
+    esigma=fitter->GetSigmaUncertainty();
+    if(esigma<0.00001) esigma=0.0001;
+    epos=fitter->GetMeanUncertainty();
+    if(epos<0.00001) epos=0.0001;
+    ry=fitter->GetRawYield();
+    ery=fitter->GetRawYieldError();
+    fB1=fitter->GetBackgroundFullRangeFunc();
+    fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
+    Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
+    Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
+    fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
+    if(out && fDrawIndividualFits && thePad){
+      thePad->Clear();
+      fitter->DrawHere(thePad, fnSigmaForBkgEval);
+      fMassFitters.push_back(fitter);
+      mustDeleteFitter = kFALSE;
+      for (auto format : fInvMassFitSaveAsFormats) {
+        thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),trial.fGlobBin, format.c_str()));
+      }
+    }
+  }
+  res[kTrialChi2]=chisq;
+  if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
+    res[kTrialFitOK]=1.;
+    res[kTrialSignif]=significance;
+    res[kTrialErrSignif]=erSignif;
+    res[kTrialMean]=pos;
+    res[kTrialErrMean]=epos;
+    res[kTrialSigma]=sigma;
+    res[kTrialErrSigma]=esigma;
+    res[kTrialRawYield]=ry;
+    res[kTrialErrRawYield]=ery;
+    res[kTrialBkg]=bkg;
+    res[kTrialErrBkg]=erbkg;
+    res[kTrialBkgBinEdges]=bkgBEdge;
+    res[kTrialErrBkgBinEdges]=erbkgBEdge;
+    for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+      Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
+      Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
+      if(minMassBC>minMassForFit &&
+          maxMassBC<maxMassForFit &&
+          minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
+          maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
+        Double_t cnts,ecnts;
+        BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,cnts,ecnts);
+        res[kNTrialResults+3*iStepBC]=1.;
+        res[kNTrialResults+3*iStepBC+1]=cnts;
+        res[kNTrialResults+3*iStepBC+2]=ecnts;
+      }
+    }
+  }
+  if (mustDeleteFitter) delete fitter;
+}
+
+//________________________________________________________________________
+void AliHFMultiTrials::FillTrialResults(const TrialConfig& trial, const Double_t* res){
+  // fills the output histograms and ntuple with the results of one trial
+
+  Int_t itrial=trial.fTrial;
+  Int_t globBin=trial.fGlobBin;
+  Int_t theCase=trial.fFitConf*kNBkgFuncCases+trial.fBkgFunc;
+  Int_t igs=trial.fFitConf;
+  Float_t xnt[15];
+  for(Int_t j=0; j<15; j++) xnt[j]=0.;
+  xnt[0]=fRebinSteps[trial.fRebinIndex];
+  xnt[1]=trial.fFirstBin;
+  xnt[2]=fLowLimFitSteps[trial.fMinMassIndex];
+  xnt[3]=fUpLimFitSteps[trial.fMaxMassIndex];
+  xnt[4]=trial.fBkgFunc;
+  xnt[6]=0;
+  if(igs==kFixSigFreeMean || igs==kFixSigFixMean) xnt[5]=1;
+  else if(igs==kFixSigUpFreeMean) xnt[5]=2;
+  else if(igs==kFixSigDownFreeMean) xnt[5]=3;
+  else xnt[5]=0;
+  if(igs==kFixSigFixMean || igs==kFreeSigFixMean) xnt[6]=1;
+  xnt[7]=res[kTrialChi2];
+  if(res[kTrialFitOK]>0.){
+    Double_t chisq=res[kTrialChi2];
+    Double_t significance=res[kTrialSignif];
+    Double_t erSignif=res[kTrialErrSignif];
+    Double_t pos=res[kTrialMean];
+    Double_t epos=res[kTrialErrMean];
+    Double_t sigma=res[kTrialSigma];
+    Double_t esigma=res[kTrialErrSigma];
+    Double_t ry=res[kTrialRawYield];
+    Double_t ery=res[kTrialErrRawYield];
+    Double_t bkg=res[kTrialBkg];
+    Double_t erbkg=res[kTrialErrBkg];
+    Double_t bkgBEdge=res[kTrialBkgBinEdges];
+    Double_t erbkgBEdge=res[kTrialErrBkgBinEdges];
+    xnt[8]=significance;
+    xnt[9]=pos;
+    xnt[10]=epos;
+    xnt[11]=sigma;
+    xnt[12]=esigma;
+    xnt[13]=ry;
+    xnt[14]=ery;
+    fHistoRawYieldDistAll->Fill(ry);
+    fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
+    fHistoRawYieldTrialAll->SetBinError(globBin,ery);
+    fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
+    fHistoSigmaTrialAll->SetBinError(globBin,esigma);
+    fHistoMeanTrialAll->SetBinContent(globBin,pos);
+    fHistoMeanTrialAll->SetBinError(globBin,epos);
+    fHistoChi2TrialAll->SetBinContent(globBin,chisq);
+    fHistoChi2TrialAll->SetBinError(globBin,0.00001);
+    fHistoSignifTrialAll->SetBinContent(globBin,significance);
+    fHistoSignifTrialAll->SetBinError(globBin,erSignif);
+    if(fSaveBkgVal) {
+      fHistoBkgTrialAll->SetBinContent(globBin,bkg);
+      fHistoBkgTrialAll->SetBinError(globBin,erbkg);
+      fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
+      fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
+    }
+
+    if(ry<fMinYieldGlob) fMinYieldGlob=ry;
+    if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
+    fHistoRawYieldDist[theCase]->Fill(ry);
+    fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
+    fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
+    fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
+    fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
+    fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
+    fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
+    fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
+    fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
+    fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
+    fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
+    if(fSaveBkgVal) {
+      fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
+      fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
+      fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
+      fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
+    }
+
+    for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+      if(res[kNTrialResults+3*iStepBC]>0.){
+        Double_t cnts=res[kNTrialResults+3*iStepBC+1];
+        Double_t ecnts=res[kNTrialResults+3*iStepBC+2];
+        fHistoRawYieldDistBinCAll->Fill(cnts);
+        fHistoRawYieldTrialBinCAll->SetBinContent(globBin,iStepBC+1,cnts);
+        fHistoRawYieldTrialBinCAll->SetBinError(globBin,iStepBC+1,ecnts);
+        fHistoRawYieldTrialBinC[theCase]->SetBinContent(itrial,iStepBC+1,cnts);
+        fHistoRawYieldTrialBinC[theCase]->SetBinError(itrial,iStepBC+1,ecnts);
+        fHistoRawYieldDistBinC[theCase]->Fill(cnts);
+      }
+    }
+  }
+  fNtupleMultiTrials->Fill(xnt);
+}
+
 //________________________________________________________________________
 void AliHFMultiTrials::SaveToRoot(TString fileName, TString option) const{
   // save histos in a root file for further analysis
@@ -86,6 +86,9 @@ class AliHFMultiTrials : public TNamed {
   void SetSaveBkgValue(Bool_t opt=kTRUE, Double_t nsigma=3) {fSaveBkgVal=opt; fnSigmaForBkgEval=nsigma;}
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
+  /// fits of the trials distributed over nWorkers forked processes (ROOT >= 6.10),
+  /// not used when drawing the individual fits
+  void SetNumberOfWorkers(Int_t nWorkers=4){fNWorkers=nWorkers;}
 
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
@@ -103,6 +106,25 @@ class AliHFMultiTrials : public TNamed {
 
  private:
 
+  /// configuration of one trial
+  struct TrialConfig {
+    Int_t fRebinIndex;    /// index in fRebinSteps
+    Int_t fFirstBin;      /// first bin for rebin
+    Int_t fMinMassIndex;  /// index in fLowLimFitSteps
+    Int_t fMaxMassIndex;  /// index in fUpLimFitSteps
+    Int_t fBkgFunc;       /// background function (EBkgFuncCases)
+    Int_t fFitConf;       /// sigma/mean configuration (EFitParamCases)
+    Int_t fTrial;         /// trial number for the histograms of one case
+    Int_t fGlobBin;       /// trial number for the histograms of all cases
+  };
+  /// results of one trial, followed by (ok,count,error) for each bin counting step
+  enum ETrialResults{ kTrialFitOK, kTrialChi2, kTrialSignif, kTrialErrSignif, kTrialMean, kTrialErrMean,
+                      kTrialSigma, kTrialErrSigma, kTrialRawYield, kTrialErrRawYield, kTrialBkg, kTrialErrBkg,
+                      kTrialBkgBinEdges, kTrialErrBkgBinEdges, kNTrialResults };
+  Int_t GetNTrialResults() const {return kNTrialResults+3*fNumOfnSigmaBinCSteps;}
+  void DoFitTrial(const TrialConfig& trial, TH1F* hRebinned, TH1D* hInvMassHisto, TPad* thePad, Double_t* res);
+  void FillTrialResults(const TrialConfig& trial, const Double_t* res);
+
   Bool_t CreateHistos();
   TH1F* RebinHisto(TH1D* hOrig, Int_t reb, Int_t firstUse) const;
   void BinCount(TH1F* h, TF1* fB, Int_t rebin, Double_t minMass, Double_t maxMass, Double_t& count, Double_t& ecount) const;
@@ -178,10 +200,12 @@ class AliHFMultiTrials : public TNamed {
   Double_t fMinYieldGlob;   /// minimum yield
   Double_t fMaxYieldGlob;   /// maximum yield
 
+  Int_t fNWorkers;          /// number of processes for the fits
+
   std::vector<AliHFMassFitterVAR*> fMassFitters; //!<! Mass fitters
 
   /// \cond CLASSIMP
-  ClassDef(AliHFMultiTrials,5); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
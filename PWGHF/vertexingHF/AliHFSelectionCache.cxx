@@ -0,0 +1,257 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////
+///
+/// Per-event cache of the selections which are repeated identically
+/// by the AliRDHFCuts objects of different HF wagons
+///
+/////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliAODEvent.h"
+#include "AliAODTrack.h"
+#include "AliAODVertex.h"
+#include "AliAODRecoDecayHF.h"
+#include "AliAnalysisManager.h"
+#include "AliAnalysisUtils.h"
+#include "AliHFSelectionCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFSelectionCache);
+/// \endcond
+
+AliHFSelectionCache* AliHFSelectionCache::fgInstance=0x0;
+
+//--------------------------------------------------------------------------
+bool AliHFSelectionCache::DaughterKey::operator<(const DaughterKey& other) const {
+  /// strict ordering of the daughter selection keys
+  if(fTrack!=other.fTrack) return fTrack<other.fTrack;
+  if(fCutsHash[0]!=other.fCutsHash[0]) return fCutsHash[0]<other.fCutsHash[0];
+  if(fCutsHash[1]!=other.fCutsHash[1]) return fCutsHash[1]<other.fCutsHash[1];
+  if(fFlags!=other.fFlags) return fFlags<other.fFlags;
+  return std::memcmp(fVtx,other.fVtx,sizeof(fVtx))<0;
+}
+//--------------------------------------------------------------------------
+bool AliHFSelectionCache::PidKey::operator<(const PidKey& other) const {
+  /// strict ordering of the PID keys
+  if(fTrack!=other.fTrack) return fTrack<other.fTrack;
+  if(fDetSpecies!=other.fDetSpecies) return fDetSpecies<other.fDetSpecies;
+  return fPidResponse<other.fPidResponse;
+}
+//--------------------------------------------------------------------------
+AliHFSelectionCache::AliHFSelectionCache():
+  TObject(),
+  fEvent(0x0),
+  fEntry(-1),
+  fRunNumber(-1),
+  fNTracks(-1),
+  fTracksFixed(kFALSE),
+  fVertices(),
+  fDaughterSel(),
+  fNSigmas(),
+  fPileupMV(),
+  fNCalls(0),
+  fNHits(0)
+{
+  /// Default constructor, use Instance()
+}
+//--------------------------------------------------------------------------
+AliHFSelectionCache::~AliHFSelectionCache() {
+  /// Destructor
+  if(fgInstance==this) fgInstance=0x0;
+}
+//--------------------------------------------------------------------------
+AliHFSelectionCache* AliHFSelectionCache::Instance() {
+  /// Return the cache shared by all the wagons of the process
+  if(!fgInstance) fgInstance=new AliHFSelectionCache();
+  return fgInstance;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFSelectionCache::CheckEvent(const AliVEvent* event) {
+  /// Drop the cache content if event is not the one it refers to.
+  /// The event is identified by the entry in the input chain, together with
+  /// pointer, run number and number of tracks (the event object is reused).
+  /// Returns kFALSE (cache not usable) outside of an analysis manager
+
+  if(!event) return kFALSE;
+  AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+  if(!mgr) return kFALSE;
+  Long64_t entry=mgr->GetCurrentEntry();
+  Int_t run=event->GetRunNumber();
+  Int_t ntracks=event->GetNumberOfTracks();
+  if(event!=fEvent || entry!=fEntry || run!=fRunNumber || ntracks!=fNTracks){
+    Clear();
+    fEvent=event;
+    fEntry=entry;
+    fRunNumber=run;
+    fNTracks=ntracks;
+  }
+  return kTRUE;
+}
+//--------------------------------------------------------------------------
+void AliHFSelectionCache::Clear(Option_t* /*opt*/) {
+  /// Drop the content of the cache
+  fEvent=0x0;
+  fEntry=-1;
+  fRunNumber=-1;
+  fNTracks=-1;
+  fTracksFixed=kFALSE;
+  fVertices.clear();
+  fDaughterSel.clear();
+  fNSigmas.clear();
+  fPileupMV.clear();
+}
+//--------------------------------------------------------------------------
+void AliHFSelectionCache::Print(Option_t* /*opt*/) const {
+  /// Print the cache usage
+  printf("AliHFSelectionCache: %lld look-ups, %lld served from the cache (%.1f%%)\n",
+	 fNCalls,fNHits,fNCalls>0 ? 100.*fNHits/fNCalls : 0.);
+  printf("  current event: %lu vertices, %lu daughter selections, %lu n-sigmas\n",
+	 (ULong_t)fVertices.size(),(ULong_t)fDaughterSel.size(),(ULong_t)fNSigmas.size());
+}
+//--------------------------------------------------------------------------
+AliAODVertex* AliHFSelectionCache::RemoveDaughtersFromPrimaryVtx(AliAODRecoDecayHF* d, AliAODEvent* aod) {
+  /// Same as AliAODRecoDecayHF::RemoveDaughtersFromPrimaryVtx (the returned vertex
+  /// is owned by the caller and the impact parameters of d are recalculated),
+  /// the vertex fit is done only once per set of removed tracks
+
+  Int_t ndg=d->GetNDaughters();
+  std::vector<Int_t> ids;
+  ids.reserve(ndg);
+  for(Int_t i=0; i<ndg; i++){
+    AliAODTrack *t=(AliAODTrack*)d->GetDaughter(i);
+    if(!t) return d->RemoveDaughtersFromPrimaryVtx(aod);
+    Int_t id=(Int_t)t->GetID();
+    if(id<0) continue;
+    ids.push_back(id);
+  }
+  std::sort(ids.begin(),ids.end());
+
+  fNCalls++;
+  std::map<std::vector<Int_t>,VertexEntry>::const_iterator it=fVertices.find(ids);
+  if(it!=fVertices.end()){
+    fNHits++;
+    const VertexEntry &entry=it->second;
+    if(!entry.fOK) return 0x0;
+    AliAODVertex *vtx=new AliAODVertex(entry.fPos,entry.fCov,entry.fChi2perNDF);
+    d->RecalculateImpPars(vtx,aod);
+    return vtx;
+  }
+
+  AliAODVertex *vtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  VertexEntry entry;
+  entry.fOK=(vtx!=0x0);
+  entry.fChi2perNDF=0.;
+  for(Int_t i=0; i<3; i++) entry.fPos[i]=0.;
+  for(Int_t i=0; i<6; i++) entry.fCov[i]=0.;
+  if(vtx){
+    vtx->GetXYZ(entry.fPos);
+    vtx->GetCovarianceMatrix(entry.fCov);
+    entry.fChi2perNDF=vtx->GetChi2perNDF();
+  }
+  fVertices[ids]=entry;
+  return vtx;
+}
+//--------------------------------------------------------------------------
+Int_t AliHFSelectionCache::GetDaughterSelection(const AliVTrack* track, const Double_t vtx[9], const ULong64_t cutsHash[2], UInt_t flags) {
+  /// Cached outcome of AliRDHFCuts::IsDaughterSelected: 1 selected, 0 rejected, -1 not available
+  DaughterKey key;
+  key.fTrack=track;
+  key.fCutsHash[0]=cutsHash[0];
+  key.fCutsHash[1]=cutsHash[1];
+  key.fFlags=flags;
+  for(Int_t i=0; i<9; i++) key.fVtx[i]=vtx[i];
+  fNCalls++;
+  std::map<DaughterKey,Bool_t>::const_iterator it=fDaughterSel.find(key);
+  if(it==fDaughterSel.end()) return -1;
+  fNHits++;
+  return it->second ? 1 : 0;
+}
+//--------------------------------------------------------------------------
+void AliHFSelectionCache::SetDaughterSelection(const AliVTrack* track, const Double_t vtx[9], const ULong64_t cutsHash[2], UInt_t flags, Bool_t selected) {
+  /// Store the outcome of AliRDHFCuts::IsDaughterSelected
+  DaughterKey key;
+  key.fTrack=track;
+  key.fCutsHash[0]=cutsHash[0];
+  key.fCutsHash[1]=cutsHash[1];
+  key.fFlags=flags;
+  for(Int_t i=0; i<9; i++) key.fVtx[i]=vtx[i];
+  fDaughterSel[key]=selected;
+}
+//--------------------------------------------------------------------------
+Double_t AliHFSelectionCache::NumberOfSigmas(const AliPIDResponse* pidResp, AliPIDResponse::EDetector det, const AliVTrack* track, Int_t species) {
+  /// TPC or TOF n-sigma from AliPIDResponse, computed once per track, detector and species
+
+  PidKey key;
+  key.fPidResponse=pidResp;
+  key.fTrack=track;
+  key.fDetSpecies=(Int_t)det*AliPID::kSPECIESC+species;
+  fNCalls++;
+  std::map<PidKey,Double_t>::const_iterator it=fNSigmas.find(key);
+  if(it!=fNSigmas.end()){
+    fNHits++;
+    return it->second;
+  }
+  Double_t nsigma=-999.;
+  AliPID::EParticleType type=(AliPID::EParticleType)species;
+  if(det==AliPIDResponse::kTPC) nsigma=pidResp->NumberOfSigmasTPC(track,type);
+  else if(det==AliPIDResponse::kTOF) nsigma=pidResp->NumberOfSigmasTOF(track,type);
+  else AliFatal(Form("Detector %d not supported",(Int_t)det));
+  fNSigmas[key]=nsigma;
+  return nsigma;
+}
+//--------------------------------------------------------------------------
+void AliHFSelectionCache::SetAODEventToTracks(AliAODEvent* aod) {
+  /// Set the pointer to the AOD event in the tracks, once per event
+  if(fTracksFixed) return;
+  Int_t nTracks=aod->GetNumberOfTracks();
+  for(Int_t itr=0; itr<nTracks; itr++){
+    AliAODTrack* tr=(AliAODTrack*)aod->GetTrack(itr);
+    tr->SetAODEvent(aod);
+  }
+  fTracksFixed=kTRUE;
+}
+//--------------------------------------------------------------------------
+Bool_t AliHFSelectionCache::IsPileUpMV(AliVEvent* event, Int_t minContrib, Float_t maxChi2, Float_t minWDz, Bool_t checkDiffBC) {
+  /// Multi-vertexer pileup check, done once per event and configuration
+
+  fNCalls++;
+  for(UInt_t i=0; i<fPileupMV.size(); i++){
+    const PileupEntry &entry=fPileupMV[i];
+    if(entry.fMinContrib==minContrib && entry.fMaxChi2==maxChi2 &&
+       entry.fMinWDz==minWDz && entry.fCheckDiffBC==checkDiffBC){
+      fNHits++;
+      return entry.fIsPileup;
+    }
+  }
+  AliAnalysisUtils utils;
+  utils.SetMinPlpContribMV(minContrib);
+  utils.SetMaxPlpChi2MV(maxChi2);
+  utils.SetMinWDistMV(minWDz);
+  utils.SetCheckPlpFromDifferentBCMV(checkDiffBC);
+  PileupEntry entry;
+  entry.fMinContrib=minContrib;
+  entry.fMaxChi2=maxChi2;
+  entry.fMinWDz=minWDz;
+  entry.fCheckDiffBC=checkDiffBC;
+  entry.fIsPileup=utils.IsPileUpMV(event);
+  fPileupMV.push_back(entry);
+  return entry.fIsPileup;
+}
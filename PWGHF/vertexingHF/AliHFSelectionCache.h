@@ -0,0 +1,110 @@
+#ifndef ALIHFSELECTIONCACHE_H
+#define ALIHFSELECTIONCACHE_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//***********************************************************
+/// \class AliHFSelectionCache
+/// \brief Per-event cache of the wagon independent parts of the HF selections
+///
+/// Shared by the AliRDHFCuts objects of all the HF wagons of a train
+/// which call AliRDHFCuts::SetUseSharedSelectionCache(kTRUE).
+/// It stores, for the current event only:
+///  - the primary vertex without the daughters of a candidate, keyed by
+///    the (sorted) IDs of the removed tracks
+///  - the outcome of the daughter track quality selection, keyed by track,
+///    primary vertex and a hash of the track cut configuration
+///  - the TPC and TOF n-sigmas from AliPIDResponse
+///  - the idempotent parts of the event selection
+/// The content is dropped as soon as a different event is seen.
+//***********************************************************
+
+#include <TObject.h>
+#include <map>
+#include <vector>
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliAODEvent;
+class AliAODVertex;
+class AliAODRecoDecayHF;
+
+class AliHFSelectionCache : public TObject
+{
+ public:
+
+  static AliHFSelectionCache* Instance();
+  virtual ~AliHFSelectionCache();
+
+  Bool_t CheckEvent(const AliVEvent* event);
+  virtual void Clear(Option_t* opt="");
+  virtual void Print(Option_t* opt="") const;
+
+  AliAODVertex* RemoveDaughtersFromPrimaryVtx(AliAODRecoDecayHF* d, AliAODEvent* aod);
+
+  Int_t GetDaughterSelection(const AliVTrack* track, const Double_t vtx[9], const ULong64_t cutsHash[2], UInt_t flags);
+  void  SetDaughterSelection(const AliVTrack* track, const Double_t vtx[9], const ULong64_t cutsHash[2], UInt_t flags, Bool_t selected);
+
+  Double_t NumberOfSigmas(const AliPIDResponse* pidResp, AliPIDResponse::EDetector det, const AliVTrack* track, Int_t species);
+
+  void   SetAODEventToTracks(AliAODEvent* aod);
+  Bool_t IsPileUpMV(AliVEvent* event, Int_t minContrib, Float_t maxChi2, Float_t minWDz, Bool_t checkDiffBC);
+
+ private:
+
+  AliHFSelectionCache();
+  AliHFSelectionCache(const AliHFSelectionCache& source);
+  AliHFSelectionCache& operator=(const AliHFSelectionCache& source);
+
+  /// key of the daughter track selection
+  struct DaughterKey {
+    const AliVTrack* fTrack;
+    ULong64_t fCutsHash[2];
+    UInt_t fFlags;
+    Double_t fVtx[9];
+    bool operator<(const DaughterKey& other) const;
+  };
+  /// key of the PID n-sigmas
+  struct PidKey {
+    const AliPIDResponse* fPidResponse;
+    const AliVTrack* fTrack;
+    Int_t fDetSpecies;
+    bool operator<(const PidKey& other) const;
+  };
+  /// primary vertex without daughters, fOK=kFALSE if the removal failed
+  struct VertexEntry {
+    Bool_t fOK;
+    Double_t fPos[3];
+    Double_t fCov[6];
+    Double_t fChi2perNDF;
+  };
+  /// configuration and outcome of the multi-vertexer pileup check
+  struct PileupEntry {
+    Int_t fMinContrib;
+    Float_t fMaxChi2;
+    Float_t fMinWDz;
+    Bool_t fCheckDiffBC;
+    Bool_t fIsPileup;
+  };
+
+  static AliHFSelectionCache* fgInstance; //!<! singleton
+
+  const AliVEvent* fEvent;        //!<! event the cache content refers to
+  Long64_t fEntry;                //!<! entry of the event in the input chain
+  Int_t fRunNumber;               //!<! run number of the event
+  Int_t fNTracks;                 //!<! number of tracks of the event
+  Bool_t fTracksFixed;            //!<! AOD event pointer set to tracks
+  std::map<std::vector<Int_t>,VertexEntry> fVertices; //!<! vertices without daughters
+  std::map<DaughterKey,Bool_t> fDaughterSel;          //!<! daughter track selection
+  std::map<PidKey,Double_t> fNSigmas;                 //!<! PID n-sigmas
+  std::vector<PileupEntry> fPileupMV;                 //!<! MV pileup checks
+  Long64_t fNCalls;               //!<! number of look-ups
+  Long64_t fNHits;                //!<! number of look-ups served from the cache
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFSelectionCache,1); /// per-event cache of the HF selections
+  /// \endcond
+};
+
+#endif
@@ -546,11 +546,54 @@ void AliMultiDimVector::Integrate(){
     AliError("MultiDimVector already integrated");
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
-  for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
+  // cumulative sum towards loose cuts, one variable at a time:
+  // after the pass on variable iVar each cell contains the counts of the
+  // cells with tighter or equal cut on iVar. Equivalent to CountsAboveCell
+  // for all the cells, with n. of variables additions per cell instead of
+  // one per cell above.
+  // Cells are processed in decreasing address order, the tighter cell
+  // always has a larger address and is therefore already summed.
+  for(Int_t iVar=0; iVar<fNVariables; iVar++){
+    for(ULong64_t i=fNTotCells; i-->0;){
+      ULong64_t tighter=GetGlobalAddressOfTighterCell(i,iVar);
+      if(tighter<fNTotCells) fVett[i]+=fVett[tighter];
+    }
+  }
   fIsIntegrated=kTRUE;
-}//_____________________________________________________________________________ 
+}
+//_____________________________________________________________________________ 
+ULong64_t AliMultiDimVector::GetGlobalAddressOfTightestCell(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
+  // returns the global address of the cell with the tightest cuts passed
+  // by a candidate with cut variables values, and in nVals the number of
+  // cells passed (i.e. the size of GetGlobalAddressesAboveCuts).
+  // Filling this cell only and calling Integrate at the end is equivalent
+  // to filling all the cells passing the cuts.
+  Int_t ind[fgkMaxNVariables];
+  Bool_t retcode=GetIndicesFromValues(values,ind);
+  if(!retcode){
+    nVals=0;
+    return fNTotCells+999;
+  }
+  nVals=1;
+  for(Int_t i=0;i<fNVariables;i++){
+    Int_t mink,maxk;
+    GetFillRange(i,ind[i],mink,maxk);
+    nVals*=(maxk-mink+1);
+  }
+  return GetGlobalAddressFromIndices(ind,ptbin);
+}
+//_____________________________________________________________________________ 
+ULong64_t AliMultiDimVector::GetGlobalAddressOfTighterCell(ULong64_t globadd, Int_t iVar) const{
+  // returns the global address of the next cell with tighter cut on variable iVar,
+  // fNTotCells if the cell globadd is already the tightest one for iVar
+  Int_t ind[fgkMaxNVariables];
+  Int_t ptbin;
+  if(!GetIndicesFromGlobalAddress(globadd,ind,ptbin)) return fNTotCells;
+  if(ind[iVar]>=fNCutSteps[iVar]-1) return fNTotCells;
+  ind[iVar]++;
+  return GetGlobalAddressFromIndices(ind,ptbin);
+}
+//_____________________________________________________________________________ 
 ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
   // fills an array with global addresses of cells passing the cuts
 
@@ -47,10 +47,13 @@
 #include "AliAnalysisUtils.h"
 #include "AliMultSelection.h"
 #include "AliAODVZERO.h"
+#include "AliHFSelectionCache.h"
 #include "TRandom.h"
 #include <TF1.h>
 #include <TFile.h>
 #include <TKey.h>
+#include <TBufferFile.h>
+#include <TMD5.h>
 
 using std::cout;
 using std::endl;
@@ -130,7 +133,9 @@ fCutGeoNcrNclFractionNcr(0.85),
 fCutGeoNcrNclFractionNcl(0.7),
 fUseV0ANDSelectionOffline(kFALSE),
 fUseTPCtrackCutsOnThisDaughter(kTRUE),
-fApplyZcutOnSPDvtx(kFALSE)
+fApplyZcutOnSPDvtx(kFALSE),
+fUseSharedSelectionCache(kFALSE),
+fDaughterCutsHash()
 {
   //
   // Default Constructor
@@ -208,7 +213,9 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fCutGeoNcrNclFractionNcl(source.fCutGeoNcrNclFractionNcl),
   fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline),
   fUseTPCtrackCutsOnThisDaughter(source.fUseTPCtrackCutsOnThisDaughter),
-  fApplyZcutOnSPDvtx(source.fApplyZcutOnSPDvtx)
+  fApplyZcutOnSPDvtx(source.fApplyZcutOnSPDvtx),
+  fUseSharedSelectionCache(source.fUseSharedSelectionCache),
+  fDaughterCutsHash()
 {
   //
   // Copy constructor
@@ -312,6 +319,8 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCutGeoNcrNclFractionNcl=source.fCutGeoNcrNclFractionNcl;
   fUseV0ANDSelectionOffline=source.fUseV0ANDSelectionOffline;
   fUseTPCtrackCutsOnThisDaughter=source.fUseTPCtrackCutsOnThisDaughter;
+  fUseSharedSelectionCache=source.fUseSharedSelectionCache;
+  fDaughterCutsHash.clear();
 
   PrintAll();
 
@@ -468,6 +477,7 @@ void AliRDHFCuts::SetupPID(AliVEvent *event) {
       AliPIDResponse *pidResp=inputHandler->GetPIDResponse();
       fPidHF->SetPidResponse(pidResp);
     }
+    fPidHF->SetUseSharedCache(fUseSharedSelectionCache);
     if(fPidHF->GetUseCombined()) fPidHF->SetUpCombinedPID();
     if(fPidHF->GetOldPid()) {
 
@@ -531,10 +541,14 @@ Bool_t AliRDHFCuts::IsEventSelected(AliVEvent *event) {
   }
 
   // TEMPORARY FIX FOR GetEvent
-  Int_t nTracks=((AliAODEvent*)event)->GetNumberOfTracks();
-  for(Int_t itr=0; itr<nTracks; itr++){
-    AliAODTrack* tr=(AliAODTrack*)((AliAODEvent*)event)->GetTrack(itr);
-    tr->SetAODEvent((AliAODEvent*)event);
+  if(fUseSharedSelectionCache && AliHFSelectionCache::Instance()->CheckEvent(event)){
+    AliHFSelectionCache::Instance()->SetAODEventToTracks((AliAODEvent*)event);
+  }else{
+    Int_t nTracks=((AliAODEvent*)event)->GetNumberOfTracks();
+    for(Int_t itr=0; itr<nTracks; itr++){
+      AliAODTrack* tr=(AliAODTrack*)((AliAODEvent*)event)->GetTrack(itr);
+      tr->SetAODEvent((AliAODEvent*)event);
+    }
   }
 
   // TEMPORARY FIX FOR REFERENCES
@@ -708,12 +722,17 @@ Bool_t AliRDHFCuts::IsEventSelected(AliVEvent *event) {
     }
   }
   else if(fOptPileup==kRejectMVPileupEvent){
-    AliAnalysisUtils utils;
-    utils.SetMinPlpContribMV(fMinContrPileup);  // min. multiplicity of the pile-up vertex to consider
-    utils.SetMaxPlpChi2MV(fMaxVtxChi2PileupMV); // max chi2 per contributor of the pile-up vertex to consider.
-    utils.SetMinWDistMV(fMinWDzPileupMV);       // minimum weighted distance in Z between 2 vertices (i.e. (zv1-zv2)/sqrt(sigZv1^2+sigZv2^2) )
-    utils.SetCheckPlpFromDifferentBCMV(fRejectPlpFromDiffBCMV); // vertex with |BCID|>2 will trigger pile-up (based on TOF)
-    Bool_t isPUMV = utils.IsPileUpMV(event);
+    Bool_t isPUMV=kFALSE;
+    if(fUseSharedSelectionCache && AliHFSelectionCache::Instance()->CheckEvent(event)){
+      isPUMV=AliHFSelectionCache::Instance()->IsPileUpMV(event,fMinContrPileup,fMaxVtxChi2PileupMV,fMinWDzPileupMV,fRejectPlpFromDiffBCMV);
+    }else{
+      AliAnalysisUtils utils;
+      utils.SetMinPlpContribMV(fMinContrPileup);  // min. multiplicity of the pile-up vertex to consider
+      utils.SetMaxPlpChi2MV(fMaxVtxChi2PileupMV); // max chi2 per contributor of the pile-up vertex to consider.
+      utils.SetMinWDistMV(fMinWDzPileupMV);       // minimum weighted distance in Z between 2 vertices (i.e. (zv1-zv2)/sqrt(sigZv1^2+sigZv2^2) )
+      utils.SetCheckPlpFromDifferentBCMV(fRejectPlpFromDiffBCMV); // vertex with |BCID|>2 will trigger pile-up (based on TOF)
+      isPUMV = utils.IsPileUpMV(event);
+    }
     if(isPUMV) {
       if(accept) fWhyRejection=1;
       fEvRejectionBits+=1<<kPileup;
@@ -723,7 +742,10 @@ Bool_t AliRDHFCuts::IsEventSelected(AliVEvent *event) {
 
 
   // Correcting PP2012 flag to remoce tracks crossing SPD misaligned staves for periods 12def
-  if(fApplySPDMisalignedPP2012 && !(event->GetRunNumber()>=195681 && event->GetRunNumber()<=197388)) fApplySPDMisalignedPP2012=false;
+  if(fApplySPDMisalignedPP2012 && !(event->GetRunNumber()>=195681 && event->GetRunNumber()<=197388)) {
+    fApplySPDMisalignedPP2012=false;
+    ResetDaughterCutsHash();
+  }
 
   return accept;
 }
@@ -845,18 +867,91 @@ void AliRDHFCuts::SetMinCrossedRowsTPCPtDep(const char *rows){
    TString tmp(rows);
    tmp.ReplaceAll("pt","x");
    f1CutMinNCrossedRowsTPCPtDep = new TFormula("f1CutMinNCrossedRowsTPCPtDep",tmp.Data());
+   ResetDaughterCutsHash();
 
    
 }
 //---------------------------------------------------------------------------
 Bool_t AliRDHFCuts::IsDaughterSelected(AliAODTrack *track,const AliESDVertex *primary,AliESDtrackCuts *cuts, const AliAODEvent* aod) const{
   //
-  // Convert to ESDtrack, relate to vertex and check cuts
+  // Check the track cuts on a daughter, with the shared cache the outcome
+  // is reused by all the cut objects with the same daughter cut configuration
   //
   if(!cuts) return kTRUE;
 
   if(cuts->GetFlagCutTOFdistance()) cuts->SetFlagCutTOFdistance(kFALSE);
 
+  // no caching when the track cuts fill their QA histograms
+  if(!fUseSharedSelectionCache || cuts->GetHistogramsOn() ||
+     !AliHFSelectionCache::Instance()->CheckEvent(track->GetAODEvent())) return ApplyDaughterCuts(track,primary,cuts,aod);
+
+  Double_t vtx[9];
+  primary->GetXYZ(vtx);
+  primary->GetCovMatrix(&vtx[3]);
+  ULong64_t hash[2];
+  GetDaughterCutsHash(cuts,hash);
+  UInt_t flags=0;
+  if(fUseTPCtrackCutsOnThisDaughter) flags|=1;
+  if(aod) flags|=2;
+  AliHFSelectionCache *cache=AliHFSelectionCache::Instance();
+  Int_t cached=cache->GetDaughterSelection(track,vtx,hash,flags);
+  if(cached>=0) return (cached==1);
+  Bool_t selected=ApplyDaughterCuts(track,primary,cuts,aod);
+  cache->SetDaughterSelection(track,vtx,hash,flags,selected);
+  return selected;
+}
+//---------------------------------------------------------------------------
+void AliRDHFCuts::GetDaughterCutsHash(const AliESDtrackCuts *cuts, ULong64_t hash[2]) const{
+  //
+  // 128-bit hash of everything ApplyDaughterCuts depends on, apart from the
+  // track and the primary vertex: the streamed track cuts (without name and
+  // title) and the daughter cuts of this class.
+  // Computed once per track cut object and reset by the setters of the
+  // daughter cuts. The track cut object must not be modified through
+  // GetTrackCuts() after the first candidate
+  //
+  std::map<const AliESDtrackCuts*,std::pair<ULong64_t,ULong64_t> >::const_iterator it=fDaughterCutsHash.find(cuts);
+  if(it!=fDaughterCutsHash.end()){
+    hash[0]=it->second.first;
+    hash[1]=it->second.second;
+    return;
+  }
+
+  AliESDtrackCuts copy(*cuts);
+  copy.SetName("");
+  copy.SetTitle("");
+  TBufferFile buf(TBuffer::kWrite);
+  copy.Streamer(buf);
+  TString formula=f1CutMinNCrossedRowsTPCPtDep ? f1CutMinNCrossedRowsTPCPtDep->GetExpFormula() : "";
+  TMD5 md5;
+  md5.Update((const UChar_t*)buf.Buffer(),buf.Length());
+  md5.Update((const UChar_t*)formula.Data(),formula.Length());
+  // daughter cuts of this class hashed with their full binary value
+  md5.Update((const UChar_t*)&fKinkReject,sizeof(fKinkReject));
+  md5.Update((const UChar_t*)&fCutRatioClsOverCrossRowsTPC,sizeof(fCutRatioClsOverCrossRowsTPC));
+  md5.Update((const UChar_t*)&fCutRatioSignalNOverCrossRowsTPC,sizeof(fCutRatioSignalNOverCrossRowsTPC));
+  md5.Update((const UChar_t*)&fUseCutGeoNcrNcl,sizeof(fUseCutGeoNcrNcl));
+  md5.Update((const UChar_t*)&fDeadZoneWidth,sizeof(fDeadZoneWidth));
+  md5.Update((const UChar_t*)&fCutGeoNcrNclLength,sizeof(fCutGeoNcrNclLength));
+  md5.Update((const UChar_t*)&fCutGeoNcrNclGeom1Pt,sizeof(fCutGeoNcrNclGeom1Pt));
+  md5.Update((const UChar_t*)&fCutGeoNcrNclFractionNcr,sizeof(fCutGeoNcrNclFractionNcr));
+  md5.Update((const UChar_t*)&fCutGeoNcrNclFractionNcl,sizeof(fCutGeoNcrNclFractionNcl));
+  md5.Update((const UChar_t*)&fApplySPDDeadPbPb2011,sizeof(fApplySPDDeadPbPb2011));
+  md5.Update((const UChar_t*)&fApplySPDMisalignedPP2012,sizeof(fApplySPDMisalignedPP2012));
+  UChar_t digest[16];
+  md5.Final(digest);
+  hash[0]=0; hash[1]=0;
+  for(Int_t i=0; i<8; i++){
+    hash[0]=(hash[0]<<8)|digest[i];
+    hash[1]=(hash[1]<<8)|digest[8+i];
+  }
+  fDaughterCutsHash[cuts]=std::make_pair(hash[0],hash[1]);
+}
+//---------------------------------------------------------------------------
+Bool_t AliRDHFCuts::ApplyDaughterCuts(AliAODTrack *track,const AliESDVertex *primary,AliESDtrackCuts *cuts, const AliAODEvent* aod) const{
+  //
+  // Convert to ESDtrack, relate to vertex and check cuts
+  //
 
   // convert to ESD track here
   AliESDtrack esdTrack(track);
@@ -1640,7 +1735,9 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
     return 0;
   }   
 
-  AliAODVertex *recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+  AliAODVertex *recvtx=0x0;
+  if(fUseSharedSelectionCache && AliHFSelectionCache::Instance()->CheckEvent(aod)) recvtx=AliHFSelectionCache::Instance()->RemoveDaughtersFromPrimaryVtx(d,aod);
+  else recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
   if(!recvtx){
     AliDebug(2,"Removal of daughter tracks failed");
     return kFALSE;
@@ -12,6 +12,7 @@
 //***********************************************************
 
 #include <TString.h>
+#include <map>
 
 #include "AliAnalysisCuts.h"
 #include "AliESDtrackCuts.h"
@@ -195,8 +196,8 @@ class AliRDHFCuts : public AliAnalysisCuts
     else AliError("Wrong option for cut on zVertexSPD");
   }
   void SetTriggerClass(TString trclass0, TString trclass1="") {fTriggerClass[0]=trclass0; fTriggerClass[1]=trclass1;} 
-  void ApplySPDDeadPbPb2011(){fApplySPDDeadPbPb2011=kTRUE;}
-  void ApplySPDMisalignedCutPP2012(){fApplySPDMisalignedPP2012=kTRUE;}
+  void ApplySPDDeadPbPb2011(){fApplySPDDeadPbPb2011=kTRUE; ResetDaughterCutsHash();}
+  void ApplySPDMisalignedCutPP2012(){fApplySPDMisalignedPP2012=kTRUE; ResetDaughterCutsHash();}
   void SetVarsForOpt(Int_t nVars,Bool_t *forOpt);
   void SetGlobalIndex(){fGlobalIndex=fnVars*fnPtBins;}
   void SetGlobalIndex(Int_t nVars,Int_t nptBins){fnVars=nVars; fnPtBins=nptBins; SetGlobalIndex();}
@@ -205,10 +206,10 @@ class AliRDHFCuts : public AliAnalysisCuts
   void SetCuts(Int_t nVars,Int_t nPtBins,Float_t** cutsRD);
   void SetCuts(Int_t glIndex, Float_t* cutsRDGlob);
   void AddTrackCuts(const AliESDtrackCuts *cuts) 
-          {delete fTrackCuts; fTrackCuts=new AliESDtrackCuts(*cuts); return;}
+          {delete fTrackCuts; fTrackCuts=new AliESDtrackCuts(*cuts); ResetDaughterCutsHash(); return;}
   void SetUsePID(Bool_t flag=kTRUE) {fUsePID=flag; return;}
   void SetUseAOD049(Bool_t flag=kTRUE) {fUseAOD049=flag; return;}
-  void SetKinkRejection(Bool_t flag=kTRUE) {fKinkReject=flag; return;}
+  void SetKinkRejection(Bool_t flag=kTRUE) {fKinkReject=flag; ResetDaughterCutsHash(); return;}
   void SetUseTrackSelectionWithFilterBits(Bool_t flag=kTRUE){ 
     fUseTrackSelectionWithFilterBits=flag; return;}
   void SetUseCentrality(Int_t flag=1);    /// see enum below
@@ -240,9 +241,12 @@ class AliRDHFCuts : public AliAnalysisCuts
 
   void SetHistoForCentralityFlattening(TH1F *h,Double_t minCentr,Double_t maxCentr,Double_t centrRef=0.,Int_t switchTRand=0);
   void SetMinCrossedRowsTPCPtDep(const char *rows="");
-  void SetMinRatioClsOverCrossRowsTPC(Float_t ratio=0.) {fCutRatioClsOverCrossRowsTPC = ratio;}
-  void SetMinRatioSignalNOverCrossRowsTPC(Float_t ratio=0.) {fCutRatioSignalNOverCrossRowsTPC = ratio;}
+  void SetMinRatioClsOverCrossRowsTPC(Float_t ratio=0.) {fCutRatioClsOverCrossRowsTPC = ratio; ResetDaughterCutsHash();}
+  void SetMinRatioSignalNOverCrossRowsTPC(Float_t ratio=0.) {fCutRatioSignalNOverCrossRowsTPC = ratio; ResetDaughterCutsHash();}
   void SetUseTPCtrackCutsOnThisDaughter(Bool_t flag=kTRUE) {fUseTPCtrackCutsOnThisDaughter=flag;}
+  /// share the wagon independent selections (vertex without daughters, daughter
+  /// track cuts, PID n-sigmas) with the other cut objects via AliHFSelectionCache
+  void SetUseSharedSelectionCache(Bool_t flag=kTRUE) {fUseSharedSelectionCache=flag;}
 
   AliAODPidHF* GetPidHF() const {return fPidHF;}
   Float_t *GetPtBinLimits() const {return fPtBinLimits;}
@@ -289,6 +293,7 @@ class AliRDHFCuts : public AliAnalysisCuts
   Float_t GetMinRatioClsOverCrossRowsTPC() const {return fCutRatioClsOverCrossRowsTPC;}
   Float_t GetMinRatioSignalNOverCrossRowsTPC() const {return fCutRatioSignalNOverCrossRowsTPC;}
   Bool_t GetUseTPCtrackCutsOnThisDaughter() const {return fUseTPCtrackCutsOnThisDaughter;}
+  Bool_t GetUseSharedSelectionCache() const {return fUseSharedSelectionCache;}
   Bool_t IsSelected(TObject *obj) {return IsSelected(obj,AliRDHFCuts::kAll);}
   Bool_t IsSelected(TList *list) {if(!list) return kTRUE; return kFALSE;}
   Int_t  IsEventSelectedInCentrality(AliVEvent *event);
@@ -390,10 +395,11 @@ class AliRDHFCuts : public AliAnalysisCuts
 
   Bool_t CheckPtDepCrossedRows(TString rows,Bool_t print=kFALSE) const;
 
-  void SetUseCutGeoNcrNcl(Bool_t opt){fUseCutGeoNcrNcl=opt;}
+  void SetUseCutGeoNcrNcl(Bool_t opt){fUseCutGeoNcrNcl=opt; ResetDaughterCutsHash();}
   void ConfigureCutGeoNcrNcl(Double_t dz, Double_t len, Double_t onept, Double_t fncr, Double_t fncl){
     fDeadZoneWidth=dz;  fCutGeoNcrNclLength=len; fCutGeoNcrNclGeom1Pt=onept;
     fCutGeoNcrNclFractionNcr=fncr; fCutGeoNcrNclFractionNcl=fncl;
+    ResetDaughterCutsHash();
   }
 
   void SetZcutOnSPDvtx() { fApplyZcutOnSPDvtx=kTRUE; }
@@ -405,6 +411,10 @@ class AliRDHFCuts : public AliAnalysisCuts
 
   Bool_t IsSignalMC(AliAODRecoDecay *d,AliAODEvent *aod,Int_t pdg) const;
   Bool_t RecomputePrimaryVertex(AliAODEvent* event) const;
+  Bool_t ApplyDaughterCuts(AliAODTrack *track,const AliESDVertex *primary,AliESDtrackCuts *cuts, const AliAODEvent* aod) const;
+  void   GetDaughterCutsHash(const AliESDtrackCuts *cuts, ULong64_t hash[2]) const;
+  /// to be called by every setter of a track cut object or of a daughter cut entering the hash
+  void   ResetDaughterCutsHash() const {fDaughterCutsHash.clear();}
 
   /// cuts on the event
   Int_t fMinVtxType; /// 0: not cut; 1: SPDZ; 2: SPD3D; 3: Tracks
@@ -482,9 +492,11 @@ class AliRDHFCuts : public AliAnalysisCuts
   Bool_t fUseV0ANDSelectionOffline; ///flag to apply V0AND selection offline
   Bool_t fUseTPCtrackCutsOnThisDaughter; ///flag to apply TPC track quality cuts on specific D-meson daughter (used for different strategies for soft pion and D0daughters from Dstar decay)
   Bool_t fApplyZcutOnSPDvtx; //flag to apply the cut on |Zvtx| > X cm using the z coordinate of the SPD vertex
+  Bool_t fUseSharedSelectionCache; /// flag to use the per-event AliHFSelectionCache shared between wagons
+  mutable std::map<const AliESDtrackCuts*,std::pair<ULong64_t,ULong64_t> > fDaughterCutsHash; //!<! hash of the daughter cut configuration for the shared cache
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,43);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,44);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -58,7 +58,7 @@ class AliRDHFCutsDStartoKpipi : public AliRDHFCuts
   void SetOffHighPtPIDinTPC(Float_t TPCrem =999.){fTPCflag = TPCrem;}
 
   void AddTrackCutsSoftPi(const AliESDtrackCuts *cuts) 
-     {fTrackCutsSoftPi=new AliESDtrackCuts(*cuts); return;}
+     {fTrackCutsSoftPi=new AliESDtrackCuts(*cuts); ResetDaughterCutsHash(); return;}
   virtual AliESDtrackCuts *GetTrackCutsSoftPi() const {return fTrackCutsSoftPi;}
 
   Double_t GetCircRadius() { return fCircRadius; }
@@ -430,6 +430,19 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // Strip-indexed tables of the acceptance correction and the low
+      // cut.  These only depend on the strip number (unless we
+      // re-calculate eta), so we look them up once per strip rather
+      // than once per sector and strip.
+      Float_t  accCache[512];
+      Double_t cutCache[512];
+      for (UShort_t t=0; t<nt; t++) { 
+	Double_t eta = fmd.Eta(d,r,0,t);
+	accCache[t]  = AcceptanceCorrection(r,t);
+	cutCache[t]  = (eta != AliESDFMD::kInvalidEta ? 
+			GetMultCut(d, r, eta, false) : 1024);
+      }
+
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
@@ -485,11 +498,12 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	    mult *= accCache[t];
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  if (eta != AliESDFMD::kInvalidEta) 
+	    cut = (fRecalculatePhi ? GetMultCut(d, r, eta,false) : cutCache[t]);
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
@@ -507,7 +521,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
 	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	    c = accCache[t];
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
 	  fCorrections->Fill(c);
@@ -222,6 +222,22 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
       UShort_t    nsec   = (q == 0 ?  20 :  40);
       UShort_t    nstr   = (q == 0 ? 512 : 256);
       RingHistos* histos = GetRingHistos(d, r);
+
+      // Strip-indexed tables.  The pseudo-rapidity only depends on
+      // the strip number, so the cuts and angle factors are looked
+      // up once per strip rather than once per sector and strip.
+      // We do not use TArrayD because we do not want a bounds check
+      Double_t etaCache[512];
+      Double_t lowCache[512];
+      Double_t highCache[512];
+      Double_t cosCache[512];
+      for (UShort_t t = 0; t < nstr; t++) { 
+	Double_t eta = input.Eta(d,r,0,t);
+	etaCache[t]  = eta;
+	lowCache[t]  = GetLowCut(d, r, eta);
+	highCache[t] = GetHighCut(d, r, eta, false);
+	cosCache[t]  = AngleCorrect(1, eta);
+      }
       
       for(UShort_t s = 0; s < nsec;  s++) {	
 	// `used' flags if the _current_ strip was used by _previous_ 
@@ -241,15 +257,17 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  // nDistanceAfter++;
 
 	  output.SetMultiplicity(d,r,s,t,0.);
-	  Float_t mult         = SignalInStrip(input,d,r,s,t);
-	  Float_t multNext     = (t<nstr-1) ? SignalInStrip(input,d,r,s,t+1) :0;
-	  Float_t multNextNext = (t<nstr-2) ? SignalInStrip(input,d,r,s,t+2) :0;
+	  Float_t mult         = SignalInStrip(input,d,r,s,t,cosCache[t]);
+	  Float_t multNext     = ((t<nstr-1) ? 
+				  SignalInStrip(input,d,r,s,t+1,cosCache[t+1]):0);
+	  Float_t multNextNext = ((t<nstr-2) ? 
+				  SignalInStrip(input,d,r,s,t+2,cosCache[t+2]):0);
 	  if (multNext     ==  AliESDFMD::kInvalidMult) multNext     = 0;
 	  if (multNextNext ==  AliESDFMD::kInvalidMult) multNextNext = 0;
 	  if(!fThreeStripSharing) multNextNext = 0;
 
 	  // Get the pseudo-rapidity 
-	  Double_t eta = input.Eta(d,r,s,t);
+	  Double_t eta = etaCache[t];
 	  Double_t phi = input.Phi(d,r,s,t) * TMath::Pi() / 180.;
 	  if (s == 0) output.SetEta(d,r,s,t,eta);
 	  
@@ -262,8 +280,8 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	    mult = AliESDFMD::kInvalidMult;
 	  }
 	  
-	  Double_t lowCut  = GetLowCut(d, r, eta);
-	  Double_t highCut = GetHighCut(d, r, eta, false);
+	  Double_t lowCut  = lowCache[t];
+	  Double_t highCut = highCache[t];
 	  if (mult != AliESDFMD::kInvalidMult && mult > lowCut) {
 	    // Always fill the ESD sum histogram 
 	    histos->fSumESD->Fill(eta, phi, mult);
@@ -405,7 +423,7 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  } // if (!fMergingDisabled)
 
 	  if (!fCorrectAngles)
-	    mergedEnergy = AngleCorrect(mergedEnergy, eta);
+	    mergedEnergy = mergedEnergy * cosCache[t];
 	  // if (mergedEnergy > 0) histos->Incr();
 	  
 	  if (t != 0) 
@@ -470,6 +488,43 @@ AliFMDSharingFilter::SignalInStrip(const AliESDFMD& input,
   return mult;
 }
 
+//_____________________________________________________________________
+Double_t 
+AliFMDSharingFilter::SignalInStrip(const AliESDFMD& input, 
+				   UShort_t         d,
+				   Char_t           r,
+				   UShort_t         s,
+				   UShort_t         t,
+				   Double_t         cosTheta) const
+{
+  // 
+  // Get the signal in a strip.  As above, but the angle factor
+  // @f$\cos\theta@f$ is passed in rather than re-calculated from
+  // the pseudo-rapidity of the strip.
+  // 
+  // Parameters:
+  //    fmd      ESD object
+  //    d        Detector
+  //    r        Ring 
+  //    s        Sector 
+  //    t        Strip
+  //    cosTheta Angle factor 
+  // 
+  // Return:
+  //    The energy signal 
+  //
+  Double_t mult = input.Multiplicity(d,r,s,t);
+  if (mult == AliESDFMD::kInvalidMult               || 
+      mult == 0                                     ||
+      (fCorrectAngles && (fIgnoreESDForAngleCorrection || input.IsAngleCorrected())) || 
+      (!fCorrectAngles && !fIgnoreESDForAngleCorrection && !input.IsAngleCorrected()))
+    return mult;
+
+  if (fCorrectAngles) mult = mult * cosTheta;
+  else                mult = mult / cosTheta;
+  return mult;
+}
+
 namespace {
   Double_t Rng2Cut(UShort_t d, Char_t r, Double_t eta, TH2* h) {
     Double_t ret = 1024;
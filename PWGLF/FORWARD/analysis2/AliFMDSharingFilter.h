@@ -341,6 +341,24 @@ protected:
 			 Char_t   r,
 			 UShort_t s,
 			 UShort_t t) const;
+  /** 
+   * Get the signal in a strip, using a pre-calculated angle factor 
+   * 
+   * @param fmd      ESD object
+   * @param d        Detector
+   * @param r        Ring 
+   * @param s        Sector 
+   * @param t        Strip
+   * @param cosTheta Angle factor @f$\cos\theta@f$ of the strip 
+   * 
+   * @return The energy signal 
+   */
+  Double_t SignalInStrip(const AliESDFMD& fmd, 
+			 UShort_t d,
+			 Char_t   r,
+			 UShort_t s,
+			 UShort_t t,
+			 Double_t cosTheta) const;
   /** 
    * Angle correct the signal 
    * 
@@ -458,17 +458,21 @@ void AliForwardFlowTaskQC::FillVtxBinList(const TList& list, TH2D& h, Int_t vtx,
   VertexBin* bin = 0;
   Int_t i = 0;
   Int_t nVtxBins = fVtxAxis->GetNbins();
+
+  // The Q-vectors are calculated once, and shared by all bins
+  QVectors q;
+  q.Fill(h, 2*fMaxMoment);
   
   while ((bin = static_cast<VertexBin*>(list.At(vtx+(nVtxBins*i))))) {
     i++;
     // If no tracks do things normally
     if (!(fFlowFlags & kTracks) || (flags & kMC)) {
-      if (!bin->FillHists(h, fCent, kFillBoth|flags|kReset)) continue;
+      if (!bin->FillHists(q, h, fCent, kFillBoth|flags|kReset)) continue;
     }
     // if tracks things are more complicated
     else if ((fFlowFlags & kTracks)) {
       if (!FillTracks(bin, kFillRef|kReset|flags)) continue;
-      if (!bin->FillHists(h, fCent, kFillDiff|kReset|flags)) continue;
+      if (!bin->FillHists(q, h, fCent, kFillDiff|kReset|flags)) continue;
     }
     bin->CumulantsAccumulate(fCent);
   }
@@ -494,15 +498,22 @@ void AliForwardFlowTaskQC::FillVtxBinListEtaGap(const TList& list, TH2D& href,
   Int_t i = 0;
   Int_t nVtxBins = fVtxAxis->GetNbins();
 
+  // The Q-vectors are calculated once, and shared by all bins
+  QVectors qdiff;
+  qdiff.Fill(hdiff, 2*fMaxMoment);
+  QVectors qref;
+  if (&href != &hdiff) qref.Fill(href, 2*fMaxMoment);
+  const QVectors& q = (&href != &hdiff ? qref : qdiff);
+
   while ((bin = static_cast<VertexBin*>(list.At(vtx+(nVtxBins*i))))) {
     i++;
     if (!(fFlowFlags & kTracks) || (flags & kMC)) {
-      if(!bin->FillHists(href, fCent, kFillRef|flags|kReset)) continue;
+      if(!bin->FillHists(q, href, fCent, kFillRef|flags|kReset)) continue;
     }
     else if ((fFlowFlags & kTracks)) {
       if (!FillTracks(bin, kFillRef|kReset|flags)) continue;
     }
-    if (!bin->FillHists(hdiff, fCent, kFillDiff|kReset|flags)) continue;
+    if (!bin->FillHists(qdiff, hdiff, fCent, kFillDiff|kReset|flags)) continue;
     bin->CumulantsAccumulate(fCent);
   }
 
@@ -529,9 +540,13 @@ void AliForwardFlowTaskQC::FillVtxBinList3Cor(const TList& list, TH2D& hcent,
 
   TH2D& h = CombineHists(hcent, hfwd);
 
+  // The Q-vectors are calculated once, and shared by all bins
+  QVectors q;
+  q.Fill(h, 2*fMaxMoment);
+
   while ((bin = static_cast<VertexBin*>(list.At(vtx+(nVtxBins*i))))) {
     i++;
-    if (!bin->FillHists(h, fCent, kFillBoth|flags|kReset)) continue;
+    if (!bin->FillHists(q, h, fCent, kFillBoth|flags|kReset)) continue;
     bin->CumulantsAccumulate3Cor(fCent);
   }
 
@@ -1260,7 +1275,27 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
   //   cent: centrality
   //   mode: filling mode: kFillRef/kFillDiff/kFillBoth
   //
+  QVectors q;
+  q.Fill(dNdetadphi, 2*fMaxMoment);
+  return FillHists(q, dNdetadphi, cent, mode);
+}
+//_____________________________________________________________________
+Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(const QVectors& q, TH2D& dNdetadphi, 
+						  Double_t cent, UShort_t mode) 
+{
+  // 
+  //  Fill reference and differential eta-histograms
+  //
+  //  Parameters:
+  //   q: Q-vectors calculated from dNdetadphi
+  //   dNdetadphi: 2D histogram with input data
+  //   cent: centrality
+  //   mode: filling mode: kFillRef/kFillDiff/kFillBoth
+  //
   if (!fCumuRef) AliFatal("You have not called AddOutput() - Terminating!");
+  if (q.GetNHarm() < 2*fMaxMoment) 
+    AliFatal(Form("Q-vectors only calculated up to n=%d - need %d", 
+		  q.GetNHarm(), 2*fMaxMoment));
   Bool_t useEvent = kTRUE;
 
   // Fist we reset histograms
@@ -1268,81 +1303,67 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
     if ((mode & kFillRef))  fCumuRef->Reset();
     if ((mode & kFillDiff)) fCumuDiff->Reset();
   }
-  // Then we loop over the input and calculate sum cos(k*n*phi)
-  // and fill it in the reference and differential histograms
+  // Then we loop over the input and fill the sums of cos(k*n*phi)
+  // in the reference and differential histograms
   Int_t nBadBins = 0;
   Double_t limit = 9999.;
   for (Int_t etaBin = 1; etaBin <= dNdetadphi.GetNbinsX(); etaBin++) {
     Double_t eta = dNdetadphi.GetXaxis()->GetBinCenter(etaBin);
-    // Numbers to cut away bad events
-    Double_t runAvg = 0;
-    Double_t max = 0;
-    Int_t nInAvg = 0;
-    Double_t avgSqr = 0;
-    for (Int_t phiBin = 0; phiBin <= dNdetadphi.GetNbinsY(); phiBin++) {
-      // Check for acceptance
-      if (phiBin == 0) {
-        if (dNdetadphi.GetBinContent(etaBin, 0) == 0) break;
-        // Central limit for eta gap break for reference flow
-	if ((fFlags & kEtaGap) && (mode & kFillRef) && 
-	    TMath::Abs(eta) < fEtaGap) break;
-	// Backward and forward eta gap break for reference flow
-	if ((fFlags & kEtaGap) && (mode & kFillRef) && TMath::Abs(eta) > TMath::Abs(limit)) break;
-	if ((fFlags & kStdQC) && (fFlags & kMC) && !(fFlags & kTracks)) {
-	  if (!(fFlags & kSPD) && TMath::Abs(eta) < 1.75) break; 
-	  if ((fFlags & kSPD) && TMath::Abs(eta) > 2.00) break;
-	}
-	if (limit > 1e3) limit = dNdetadphi.GetXaxis()->GetBinLowEdge(etaBin);
-	continue;
-      } // End of phiBin == 0
-      Double_t phi = dNdetadphi.GetYaxis()->GetBinCenter(phiBin);
-      Double_t weight = dNdetadphi.GetBinContent(etaBin, phiBin);
-        
-      // We calculate the average Nch per. bin
-      avgSqr += weight*weight;
-      runAvg += weight;
-      nInAvg++;
-      if (weight == 0) continue;
-      if (weight > max) max = weight;
-      // Fill into Cos() and Sin() hists
-      if ((mode & kFillRef) && !((fFlags & kTracks) && (fFlags & kMC) && TMath::Abs(eta) > 0.75)) {
-	fCumuRef->Fill(eta, 0., weight);// mult goes in underflowbin - no visual, but not needed?
-        fdNdedpRefAcc->Fill(eta, phi, weight);
-      }
-      if ((mode & kFillDiff)) {
-	fCumuDiff->Fill(eta, 0., weight);
-        fdNdedpDiffAcc->Fill(eta, phi, weight);
+    // Check for acceptance
+    if (dNdetadphi.GetBinContent(etaBin, 0) == 0) continue;
+    // Central limit for eta gap break for reference flow
+    if ((fFlags & kEtaGap) && (mode & kFillRef) && 
+	TMath::Abs(eta) < fEtaGap) continue;
+    // Backward and forward eta gap break for reference flow
+    if ((fFlags & kEtaGap) && (mode & kFillRef) && TMath::Abs(eta) > TMath::Abs(limit)) continue;
+    if ((fFlags & kStdQC) && (fFlags & kMC) && !(fFlags & kTracks)) {
+      if (!(fFlags & kSPD) && TMath::Abs(eta) < 1.75) continue; 
+      if ((fFlags & kSPD) && TMath::Abs(eta) > 2.00) continue;
+    }
+    if (limit > 1e3) limit = dNdetadphi.GetXaxis()->GetBinLowEdge(etaBin);
+    if (dNdetadphi.GetNbinsY() <= 0) continue;
+
+    Bool_t   fillRef  = ((mode & kFillRef) && 
+			 !((fFlags & kTracks) && (fFlags & kMC) && TMath::Abs(eta) > 0.75));
+    Bool_t   fillDiff = (mode & kFillDiff);
+    Double_t mult     = q.Mult(etaBin);
+    if (mult != 0) { 
+      // Acceptance maps 
+      for (Int_t phiBin = 1; phiBin <= dNdetadphi.GetNbinsY(); phiBin++) {
+	Double_t weight = dNdetadphi.GetBinContent(etaBin, phiBin);
+	if (weight == 0) continue;
+	Double_t phi = dNdetadphi.GetYaxis()->GetBinCenter(phiBin);
+	if (fillRef)  fdNdedpRefAcc->Fill(eta, phi, weight);
+	if (fillDiff) fdNdedpDiffAcc->Fill(eta, phi, weight);
       }
+      // Fill into Cos() and Sin() hists
+      if (fillRef)  fCumuRef->Fill(eta, 0., mult);// mult goes in underflowbin - no visual, but not needed?
+      if (fillDiff) fCumuDiff->Fill(eta, 0., mult);
       for (Int_t n = 1; n <= 2*fMaxMoment; n++) {
 	Double_t cosBin = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberCos(n));
 	Double_t sinBin = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberSin(n));
-	Double_t cosnPhi = weight*TMath::Cos(n*phi);
-	Double_t sinnPhi = weight*TMath::Sin(n*phi);
-        // fill ref
-	if ((mode & kFillRef) && !((fFlags & kTracks) && (fFlags & kMC) && TMath::Abs(eta) > 0.75)) {
+	Double_t cosnPhi = q.Cos(etaBin, n);
+	Double_t sinnPhi = q.Sin(etaBin, n);
+	// fill ref
+	if (fillRef) {
 	  fCumuRef->Fill(eta, cosBin, cosnPhi);
 	  fCumuRef->Fill(eta, sinBin, sinnPhi);
 	}
 	// fill diff
-	if ((mode & kFillDiff)) {
+	if (fillDiff) {
 	  fCumuDiff->Fill(eta, cosBin, cosnPhi);
 	  fCumuDiff->Fill(eta, sinBin, sinnPhi);
 	}
       } // End of NUA loop
-    } // End of phi loop
-    // Outlier cut calculations
-    if (nInAvg > 0) {
-      runAvg /= nInAvg;
-      avgSqr /= nInAvg;
-      Double_t stdev = (nInAvg > 1 ? TMath::Sqrt(nInAvg/(nInAvg-1))*TMath::Sqrt(avgSqr - runAvg*runAvg) : 0);
-      Double_t nSigma = (stdev == 0 ? 0 : (max-runAvg)/stdev);
-      if (fSigmaCut > 0. && nSigma >= fSigmaCut && cent < 60) nBadBins++;
-      else nBadBins = 0;
-      fOutliers->Fill(cent, nSigma);
-      // We still finish the loop, for fOutliers to make sense, 
-      // but we do no keep the event for analysis 
-      if (nBadBins > 3) useEvent = kFALSE;
     }
+    // Outlier cut calculations
+    Double_t nSigma = q.NSigma(etaBin);
+    if (fSigmaCut > 0. && nSigma >= fSigmaCut && cent < 60) nBadBins++;
+    else nBadBins = 0;
+    fOutliers->Fill(cent, nSigma);
+    // We still finish the loop, for fOutliers to make sense, 
+    // but we do no keep the event for analysis 
+    if (nBadBins > 3) useEvent = kFALSE;
   } // End of eta bin
 
   return useEvent;
@@ -3041,6 +3062,70 @@ Int_t AliForwardFlowTaskQC::CumuHistos::GetPos(Int_t n, UInt_t nua) const
   else return (n-2)+nua*(fMaxMoment-1);
 }
 //_____________________________________________________________________
+void AliForwardFlowTaskQC::QVectors::Fill(const TH2D& h, Int_t nHarm)
+{
+  //
+  //  Calculate sum w, sum w cos(n*phi), and sum w sin(n*phi) for each
+  //  eta bin of a d^2N/detadphi histogram, as well as the outlier
+  //  measure of each eta bin.  The harmonics of the phi bin centres
+  //  are evaluated once per phi bin, not once per (eta,phi) bin.
+  //
+  //  Parameters:
+  //   h: d^2N/detadphi histogram
+  //   nHarm: largest harmonic to calculate
+  //
+  fNEta  = h.GetNbinsX();
+  fNHarm = nHarm;
+  Int_t nPhi  = h.GetNbinsY();
+  Int_t nCols = 2*fNHarm+1;
+  fQ.Set(fNEta*nCols);
+  fQ.Reset(0);
+  fNSigma.Set(fNEta);
+  fNSigma.Reset(0);
+
+  // Table of cos(n*phi), sin(n*phi) for the phi bin centres
+  TArrayD harm(nPhi*2*fNHarm);
+  for (Int_t phiBin = 1; phiBin <= nPhi; phiBin++) {
+    Double_t phi = h.GetYaxis()->GetBinCenter(phiBin);
+    Double_t* row = &(harm.GetArray()[(phiBin-1)*2*fNHarm]);
+    for (Int_t n = 1; n <= fNHarm; n++) {
+      row[2*n-2] = TMath::Cos(n*phi);
+      row[2*n-1] = TMath::Sin(n*phi);
+    }
+  }
+
+  for (Int_t etaBin = 1; etaBin <= fNEta; etaBin++) {
+    // Outside acceptance 
+    if (h.GetBinContent(etaBin, 0) == 0) continue;
+    Double_t* q = &(fQ.GetArray()[Pos(etaBin)]);
+    // Numbers to cut away bad events
+    Double_t runAvg = 0;
+    Double_t max = 0;
+    Int_t nInAvg = 0;
+    Double_t avgSqr = 0;
+    for (Int_t phiBin = 1; phiBin <= nPhi; phiBin++) {
+      Double_t weight = h.GetBinContent(etaBin, phiBin);
+
+      // We calculate the average Nch per. bin
+      avgSqr += weight*weight;
+      runAvg += weight;
+      nInAvg++;
+      if (weight == 0) continue;
+      if (weight > max) max = weight;
+
+      const Double_t* row = &(harm.GetArray()[(phiBin-1)*2*fNHarm]);
+      q[0] += weight;
+      for (Int_t k = 0; k < 2*fNHarm; k++) q[k+1] += weight*row[k];
+    } // End of phi loop
+    if (nInAvg > 0) {
+      runAvg /= nInAvg;
+      avgSqr /= nInAvg;
+      Double_t stdev = (nInAvg > 1 ? TMath::Sqrt(nInAvg/(nInAvg-1))*TMath::Sqrt(avgSqr - runAvg*runAvg) : 0);
+      fNSigma[etaBin-1] = (stdev == 0 ? 0 : (max-runAvg)/stdev);
+    }
+  } // End of eta loop
+}
+//_____________________________________________________________________
 //
 //
 // EOF
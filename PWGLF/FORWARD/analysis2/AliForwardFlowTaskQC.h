@@ -14,6 +14,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "TString.h"
 #include <TH2D.h>
+#include <TArrayD.h>
 class AliAODForwardMult;
 class TH1I;
 class TH1D;
@@ -274,6 +275,81 @@ public:
 
     // ClassDef(CumuHistos, 1);
   }; // End of struct
+  /**
+   * struct to hold the @f$\phi@f$-harmonic sums of a 
+   * @f$d^2N/d\eta d\phi@f$ histogram in a dense (eta x harmonic)
+   * array.  It is calculated once per event and input histogram, and
+   * shared by all VertexBin objects filled from that histogram.
+   * Used internally and never streamed.
+   */
+  struct QVectors
+  {
+  public:
+    /*
+     * Constructor
+     */
+    QVectors() : fNEta(0), fNHarm(0), fQ(), fNSigma() {}
+    /**
+     * Calculate the sums from a histogram 
+     *
+     * @param h     @f$d^2N/d\eta d\phi@f$ histogram 
+     * @param nHarm Largest harmonic to calculate 
+     */
+    void Fill(const TH2D& h, Int_t nHarm);
+    /**
+     * Get @f$\sum w@f$ for an eta bin 
+     *
+     * @param etaBin eta bin (1 to N)
+     *
+     * @return Multiplicity 
+     */
+    Double_t Mult(Int_t etaBin) const { return fQ[Pos(etaBin)]; }
+    /**
+     * Get @f$\sum w\cos(n\phi)@f$ for an eta bin 
+     *
+     * @param etaBin eta bin (1 to N)
+     * @param n      Harmonic (1 to nHarm)
+     *
+     * @return real part of Q-vector 
+     */
+    Double_t Cos(Int_t etaBin, Int_t n) const { return fQ[Pos(etaBin)+2*n-1]; }
+    /**
+     * Get @f$\sum w\sin(n\phi)@f$ for an eta bin 
+     *
+     * @param etaBin eta bin (1 to N)
+     * @param n      Harmonic (1 to nHarm)
+     *
+     * @return imaginary part of Q-vector 
+     */
+    Double_t Sin(Int_t etaBin, Int_t n) const { return fQ[Pos(etaBin)+2*n]; }
+    /**
+     * Get the number of standard deviations the largest @f$\phi@f$
+     * bin is from the mean of an eta bin - used for outlier cuts
+     *
+     * @param etaBin eta bin (1 to N)
+     *
+     * @return @f$(max - \langle w\rangle)/\sigma_w@f$
+     */
+    Double_t NSigma(Int_t etaBin) const { return fNSigma[etaBin-1]; }
+    /**
+     * @return Largest harmonic calculated
+     */
+    Int_t GetNHarm() const { return fNHarm; }
+  protected:
+    /**
+     * Get position of eta bin in array
+     *
+     * @param etaBin eta bin (1 to N)
+     *
+     * @return position 
+     */
+    Int_t Pos(Int_t etaBin) const { return (etaBin-1)*(2*fNHarm+1); }
+
+    Int_t   fNEta;   // Number of eta bins 
+    Int_t   fNHarm;  // Largest harmonic 
+    TArrayD fQ;      // (eta x (1 + 2 nHarm)) sums 
+    TArrayD fNSigma; // Outlier measure per eta bin 
+  }; // End of struct
 
 protected:
   /**
@@ -366,6 +442,19 @@ protected:
      * @return false if bad event (det. hotspot)
      */
     Bool_t FillHists(TH2D& dNdetadphi, Double_t cent, UShort_t mode);
+    /**
+     * Fill reference and differential flow histograms for analysis
+     * using pre-calculated Q-vectors of the histogram as input
+     *
+     * @param q          Q-vectors of @a dNdetadphi 
+     * @param dNdetadphi 2D data histogram
+     * @param cent       Centrality
+     * @param mode       fill ref/diff or both
+     *
+     * @return false if bad event (det. hotspot)
+     */
+    Bool_t FillHists(const QVectors& q, TH2D& dNdetadphi, 
+		     Double_t cent, UShort_t mode);
     /** 
      * Fill reference and differential flow histograms for analysis 
      * using tracks as input
@@ -13,6 +13,8 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 
 #include <Riostream.h>
+#include <algorithm>
+#include <map>
 
 #include <TH1.h>
 #include <TList.h>
@@ -105,7 +107,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fRsnTreeInFile(kFALSE),
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fEvBufferInMemory(kFALSE),
+   fEvStore(),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle()
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -166,7 +173,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fRsnTreeInFile(saveRsnTreeInFile),
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fEvBufferInMemory(kFALSE),
+   fEvStore(),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle()
 {
 //
 // Default constructor.
@@ -233,7 +245,12 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fRsnTreeInFile(copy.fRsnTreeInFile),
    fComputeSpherocity(copy.fComputeSpherocity),
    fSpherocity(copy.fSpherocity),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fEvBufferInMemory(copy.fEvBufferInMemory),
+   fEvStore(),
+   fMixVz(),
+   fMixMult(),
+   fMixAngle()
 {
 //
 // Copy constructor.
@@ -302,6 +319,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fComputeSpherocity = copy.fComputeSpherocity;
    fSpherocity = copy.fSpherocity;
    fResonanceFinders = copy.fResonanceFinders;
+   fEvBufferInMemory = copy.fEvBufferInMemory;
 
    return (*this);
 }
@@ -318,6 +336,7 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
       delete fOutput;
       delete fEvBuffer;
    }
+   ClearEventStore();
 }
 
 //__________________________________________________________________________________________________
@@ -497,10 +516,7 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
    if (fMiniEvent->IsEmpty()) {
       AliDebugClass(2, Form("Rejecting empty event #%d", fEvNum));
    } else {
-      Int_t id = fEvBuffer->GetEntries();
-      AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
-      fMiniEvent->ID() = id;
-      fEvBuffer->Fill();
+      StoreMiniEvent();
    }
 
    // post data for computed stuff
@@ -519,14 +535,23 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
 //
 
    // security code: reassign the buffer to the mini-event cursor
-   fEvBuffer->SetBranchAddress("events", &fMiniEvent);
+   if (!fEvBufferInMemory) fEvBuffer->SetBranchAddress("events", &fMiniEvent);
    TStopwatch timer;
    // prepare variables
-   Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
+   Int_t ievt, nEvents = fEvBufferInMemory ? (Int_t)fEvStore.size() : (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
    Int_t imix, iloop, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
+   AliRsnMiniEvent *event = 0x0;
+
+   // the stored copies see the same transient references as the cursor
+   // which is read back from the buffer tree
+   for (ievt = 0; ievt < (Int_t)fEvStore.size(); ievt++) {
+      fEvStore[ievt]->SetRef(fMiniEvent->GetRef());
+      fEvStore[ievt]->SetRefMC(fMiniEvent->GetRefMC());
+      fEvStore[ievt]->SetQnVector(fMiniEvent->GetQnVector());
+   }
 
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
@@ -542,7 +567,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    timer.Start();
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
-      fEvBuffer->GetEntry(ievt);
+      event = GetStoredEvent(ievt);
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -557,23 +582,23 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             case AliRsnMiniOutput::kEventOnly:
                //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
                ifill = 1;
-               def->FillEvent(fMiniEvent, &fValues);
+               def->FillEvent(event, &fValues);
                break;
             case AliRsnMiniOutput::kTruePair:
                //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPair:
                //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPairRotated1:
                //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             case AliRsnMiniOutput::kTrackPairRotated2:
                //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
+               ifill = def->FillPair(event, event, &fValues);
                break;
             default:
                // other kinds are processed elsewhere
@@ -588,18 +613,52 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // if no mixing is required, stop here and post the output
    if (fNMix < 1) {
       AliDebugClass(2, "Stopping here, since no mixing is required");
+      ClearEventStore();
       PostData(1, fOutput);
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
+   // mixing variables of all events, normally collected in UserExec,
+   // read back from the buffer if not available
+   if ((Int_t)fMixVz.size() != nEvents) {
+      fMixVz.resize(nEvents);
+      fMixMult.resize(nEvents);
+      fMixAngle.resize(nEvents);
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         event = GetStoredEvent(ievt);
+         fMixVz[ievt]    = event->Vz();
+         fMixMult[ievt]  = event->Mult();
+         fMixAngle[ievt] = event->Angle();
+      }
+   }
+
+   // for binned mixing, list the events of each bin, in increasing order:
+   // the candidates of an event are the following events of its bin, 
+   // then the first ones, as in the scan of all events
+   std::vector<Int_t> mixBin(nEvents, 0);
+   std::vector< std::vector<Int_t> > mixBinEvents;
+   std::vector<Int_t> mixBinPos(nEvents, 0);
+   if (!fContinuousMix) {
+      std::map< std::vector<Int_t>, Int_t > binIndex;
+      std::vector<Int_t> key(3);
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         key[0] = (Int_t)(fMixVz[ievt] / fMaxDiffVz);
+         key[1] = (Int_t)(fMixMult[ievt] / fMaxDiffMult);
+         key[2] = (Int_t)(fMixAngle[ievt] / fMaxDiffAngle);
+         std::map< std::vector<Int_t>, Int_t >::iterator it = binIndex.find(key);
+         if (it == binIndex.end()) {
+            it = binIndex.insert(std::make_pair(key, (Int_t)mixBinEvents.size())).first;
+            mixBinEvents.push_back(std::vector<Int_t>());
+         }
+         mixBin[ievt] = it->second;
+         mixBinPos[ievt] = mixBinEvents[it->second].size();
+         mixBinEvents[it->second].push_back(ievt);
+      }
    }
 
+   // initialize mixing counter
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > smatched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
@@ -611,63 +670,71 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
+      const std::vector<Int_t> *binEvents = fContinuousMix ? 0x0 : &mixBinEvents[mixBin[ievt]];
+      Int_t nLoop = fContinuousMix ? nEvents : (Int_t)binEvents->size();
+      for (iloop = 1; iloop < nLoop; iloop++) {
+         if (fContinuousMix) {
+            imix = ievt + iloop;
+            if (imix >= nEvents) imix -= nEvents;
+            if (imix == ievt) continue;
+            // skip if events are not matched
+            if (!EventsMatch(fMixVz[ievt], fMixMult[ievt], fMixAngle[ievt], fMixVz[imix], fMixMult[imix], fMixAngle[imix])) continue;
+         } else {
+            // all events of the bin are matched
+            Int_t ipos = mixBinPos[ievt] + iloop;
+            if (ipos >= nLoop) ipos -= nLoop;
+            imix = (*binEvents)[ipos];
+         }
          // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
+         if (std::find(smatched[imix].begin(), smatched[imix].end(), ievt) != smatched[imix].end()) continue;
          // check that the found good events has not enough matches already
          if (nmatched[imix] >= fNMix) continue;
          // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
+         smatched[ievt].push_back(imix);
          nmatched[ievt]++;
          nmatched[imix]++;
          if (nmatched[ievt] >= fNMix) break;
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
+   UInt_t imatch;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
+      if (smatched[ievt].empty()) continue;
+      // the main event is copied when read from the buffer tree, 
+      // since the cursor is then used for the mixing partners
+      AliRsnMiniEvent evCopy;
+      AliRsnMiniEvent *evMain = GetStoredEvent(ievt);
+      if (evMain == fMiniEvent) {
+         evCopy = *fMiniEvent;
+         evMain = &evCopy;
+      }
+      for (imatch = 0; imatch < smatched[ievt].size(); imatch++) {
+         imix = smatched[ievt][imatch];
+         event = GetStoredEvent(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
             if (!def) continue;
             if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
+            ifill += def->FillPair(evMain, event, &fValues, kTRUE);
             if (!def->IsSymmetric()) {
                AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+               ifill += def->FillPair(event, evMain, &fValues, kFALSE);
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
+   ClearEventStore();
 
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
@@ -1552,33 +1619,43 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Check if two events are compatible, from their vz, multiplicity and angle.
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
       if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Vz = %f", dv));
          return kFALSE;
       }
       if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Mult = %f", dm));
          return kFALSE;
       }
       if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
+         //AliDebugClass(2, Form("Events don't match due to a too large diff in Angle = %f", da));
          return kFALSE;
       }
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1586,6 +1663,54 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::StoreMiniEvent()
+{
+//
+// Store the current mini-event for the pair filling in FinishTaskOutput.
+// It goes to the buffer tree, and is copied in memory if requested
+// (the tree is then filled only when it is saved in the output file).
+// The mixing variables are kept aside to search for the mixing partners
+// without reading back the events.
+//
+
+   Int_t id = fEvBufferInMemory ? (Int_t)fEvStore.size() : (Int_t)fEvBuffer->GetEntries();
+   AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
+   fMiniEvent->ID() = id;
+   if (!fEvBufferInMemory || fRsnTreeInFile) fEvBuffer->Fill();
+   if (fEvBufferInMemory) fEvStore.push_back(new AliRsnMiniEvent(*fMiniEvent));
+   fMixVz.push_back(fMiniEvent->Vz());
+   fMixMult.push_back(fMiniEvent->Mult());
+   fMixAngle.push_back(fMiniEvent->Angle());
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEvent *AliRsnMiniAnalysisTask::GetStoredEvent(Int_t ievt)
+{
+//
+// Return the stored mini-event with the given ID.
+// When read from the buffer tree, this is the cursor, overwritten by the next call.
+//
+
+   if (fEvBufferInMemory) return fEvStore[ievt];
+   fEvBuffer->GetEntry(ievt);
+   return fMiniEvent;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::ClearEventStore()
+{
+//
+// Delete the mini-events kept in memory
+//
+
+   for (UInt_t i = 0; i < fEvStore.size(); i++) delete fEvStore[i];
+   fEvStore.clear();
+   fMixVz.clear();
+   fMixMult.clear();
+   fMixAngle.clear();
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
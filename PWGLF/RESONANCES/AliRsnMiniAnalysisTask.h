@@ -12,6 +12,7 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <vector>
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -72,6 +73,7 @@ public:
    void                SetMotherAcceptanceCutMaxEta(Float_t maxEta){fMotherAcceptanceCutMaxEta = maxEta;}
    void                KeepMotherInAcceptance(Bool_t keepMotherInAcceptance) {fKeepMotherInAcceptance = keepMotherInAcceptance;}
    void                SaveRsnTreeInFile(Bool_t saveInFile=kTRUE) {fRsnTreeInFile = saveInFile;}
+   void                SetEventBufferInMemory(Bool_t inMemory=kTRUE) {fEvBufferInMemory = inMemory;}
    void                SetComputeSpherocity(Bool_t doit=kTRUE) {fComputeSpherocity = doit;}
 
    Int_t               AddTrackCuts(AliRsnCutSet *cuts);
@@ -110,6 +112,10 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   void     StoreMiniEvent();
+   AliRsnMiniEvent *GetStoredEvent(Int_t ievt);
+   void     ClearEventStore();
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -170,8 +176,13 @@ private:
    Bool_t               fComputeSpherocity; // compute spherocity, false by default since spherocity calculation is time-consuming
    Double_t             fSpherocity; // stores value of spherocity
    TObjArray            fResonanceFinders; // list of AliRsnMiniResonanceFinder objects
+   Bool_t               fEvBufferInMemory; // keep the mini-events in memory for the pair filling instead of reading them back from the buffer tree
+   std::vector<AliRsnMiniEvent*> fEvStore; //! mini-events kept in memory, by ID
+   std::vector<Float_t> fMixVz;           //! vz of the stored mini-events, by ID
+   std::vector<Float_t> fMixMult;         //! multiplicity of the stored mini-events, by ID
+   std::vector<Float_t> fMixAngle;        //! angle of the stored mini-events, by ID
 
-   ClassDef(AliRsnMiniAnalysisTask, 18);   // AliRsnMiniAnalysisTask
+   ClassDef(AliRsnMiniAnalysisTask, 19);   // AliRsnMiniAnalysisTask
 };
 
 
@@ -115,6 +115,7 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliWeakResultCutIndex.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityRun2.h"
 
 using std::cout;
@@ -167,6 +168,9 @@ fMaxPtToSave( 100.00 ),
 //---> Sandbox switch
 fkSandboxMode ( kFALSE ),
 
+//---> Configuration index switch
+fkUseConfigurationIndex ( kTRUE ),
+
 //---> Variables for fTreeEvent
 fCentrality(0),
 fMVPileupFlag(kFALSE),
@@ -456,7 +460,12 @@ fTreeCascVarNegTrack(0x0),
 fTreeCascVarMagneticField(0),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutIndex(0x0),
+fCascadeCutIndex(0x0),
+fV0Configurations(),
+fCascadeConfigurations(),
+fSelectedConfigurations()
 //------------------------------------------------
 // Tree Variables
 {
@@ -508,6 +517,9 @@ fMaxPtToSave( 100.00 ),
 //---> Sandbox switch
 fkSandboxMode ( kFALSE ),
 
+//---> Configuration index switch
+fkUseConfigurationIndex ( kTRUE ),
+
 //---> Variables for fTreeEvent
 fCentrality(0),
 fMVPileupFlag(kFALSE),
@@ -798,7 +810,12 @@ fTreeCascVarMagneticField(0),
 //Histos
 fHistEventCounter(0),
 fHistEventCounterDifferential(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutIndex(0x0),
+fCascadeCutIndex(0x0),
+fV0Configurations(),
+fCascadeConfigurations(),
+fSelectedConfigurations()
 {
     
     //Re-vertex: Will only apply for cascade candidates
@@ -916,6 +933,14 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
         delete fRand;
         fRand = 0x0;
     }
+    if (fV0CutIndex) {
+        delete fV0CutIndex;
+        fV0CutIndex = 0x0;
+    }
+    if (fCascadeCutIndex) {
+        delete fCascadeCutIndex;
+        fCascadeCutIndex = 0x0;
+    }
 }
 
 //________________________________________________________________________
@@ -2047,8 +2072,26 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
         TH3F *histoout         = 0x0;
         AliV0Result *lV0Result = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
-            lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        
+        //Configurations to check: all, or only those passing the indexed cuts
+        Int_t lNumberOfCandidateConfigurations = lNumberOfConfigurations;
+        if( fkUseConfigurationIndex ){
+            if( !fV0CutIndex || fV0CutIndex->GetNConfigurations() != lNumberOfConfigurations ) BuildV0CutIndex();
+            //Same order as in BuildV0CutIndex
+            Double_t lV0CutValues[10] = {
+                (Double_t)lOnFlyStatus, (Double_t)lOnFlyStatus,
+                fTreeVariableV0Radius, fTreeVariableV0Radius,
+                fTreeVariableDcaNegToPrimVertex, fTreeVariableDcaPosToPrimVertex,
+                fTreeVariableDcaV0Daughters, fTreeVariableV0CosineOfPointingAngle,
+                (Double_t)fTreeVariableLeastNbrCrossedRows, fTreeVariableLeastRatioCrossedRowsOverFindable
+            };
+            fV0CutIndex->Select(lV0CutValues, fSelectedConfigurations);
+            lNumberOfCandidateConfigurations = fSelectedConfigurations.size();
+        }
+        
+        for(Int_t icand=0; icand<lNumberOfCandidateConfigurations; icand++){
+            if( fkUseConfigurationIndex ) lV0Result = fV0Configurations[fSelectedConfigurations[icand]];
+            else lV0Result = (AliV0Result*) fListV0->At(icand);
             histoout  = lV0Result->GetHistogram();
             
             Float_t lMass = 0;
@@ -2063,17 +2106,17 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             //========================================================================
             //Setting up: Variable V0 CosPA
             Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
             if( lV0Result->GetCutUseVarV0CosPA() ){
+                Float_t lVarV0CosPApar[5];
+                lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+                lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+                lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+                lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+                lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
+                                                 lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
+                                                 lVarV0CosPApar[4]);
                 //Only use if tighter than the non-variable cut
                 if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
             }
@@ -3000,26 +3043,55 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         AliCascadeResult *lPointers[50000];
         Long_t lValidConfigurations=0;
         
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
+        if( fkUseConfigurationIndex ){
+            //Only the configurations passing the indexed cuts, in the same order
+            Int_t lNumberOfConfigurations = fListXiMinus->GetEntries() + fListXiPlus->GetEntries() +
+            fListOmegaMinus->GetEntries() + fListOmegaPlus->GetEntries();
+            if( !fCascadeCutIndex || fCascadeCutIndex->GetNConfigurations() != lNumberOfConfigurations ) BuildCascadeCutIndex();
+            //Same order as in BuildCascadeCutIndex
+            Double_t lCascadeCutValues[15] = {
+                (Double_t)fTreeCascVarCharge, (Double_t)fTreeCascVarCharge,
+                fTreeCascVarDCANegToPrimVtx, fTreeCascVarDCAPosToPrimVtx,
+                fTreeCascVarDCAV0Daughters, fTreeCascVarV0CosPointingAngle,
+                fTreeCascVarV0Radius, fTreeCascVarDCAV0ToPrimVtx,
+                fTreeCascVarDCABachToPrimVtx, fTreeCascVarDCACascDaughters,
+                fTreeCascVarCascCosPointingAngle, fTreeCascVarCascRadius,
+                (Double_t)fTreeCascVarLeastNbrClusters, fTreeCascVarDCABachToBaryon,
+                fTreeCascVarV0Lifetime
+            };
+            fCascadeCutIndex->Select(lCascadeCutValues, fSelectedConfigurations);
+            for( UInt_t icand=0; icand<fSelectedConfigurations.size(); icand++ ){
+                lCascadeResult = fCascadeConfigurations[fSelectedConfigurations[icand]];
+                if( (lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    && lValidXiMinus   ) ||
+                   (lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     && lValidXiPlus    ) ||
+                   (lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus && lValidOmegaMinus) ||
+                   (lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  && lValidOmegaPlus ) ){
+                    lPointers[lValidConfigurations] = lCascadeResult;
+                    lValidConfigurations++;
+                }
             }
+        }else{
+            if( lValidXiMinus )
+                for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
+                    lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
+                    lValidConfigurations++;
+                }
+            if( lValidXiPlus )
+                for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
+                    lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
+                    lValidConfigurations++;
+                }
+            if( lValidOmegaMinus )
+                for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
+                    lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
+                    lValidConfigurations++;
+                }
+            if( lValidOmegaPlus )
+                for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
+                    lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
+                    lValidConfigurations++;
+                }
+        }
         
         for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
             lCascadeResult = lPointers[lcfg];
@@ -3071,17 +3143,17 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             //========================================================================
             //Setting up: Variable Cascade CosPA
             Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[4]);
             if( lCascadeResult->GetCutUseVarCascCosPA() ){
+                Float_t lVarCascCosPApar[5];
+                lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+                lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+                lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+                lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+                lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+                Float_t lVarCascCosPA = TMath::Cos(
+                                                   lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
+                                                   lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
+                                                   lVarCascCosPApar[4]);
                 //Only use if tighter than the non-variable cut
                 if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
             }
@@ -3090,17 +3162,17 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             //========================================================================
             //Setting up: Variable V0 CosPA
             Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[4]);
             if( lCascadeResult->GetCutUseVarV0CosPA() ){
+                Float_t lVarV0CosPApar[5];
+                lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+                lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+                lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+                lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+                lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
+                                                 lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
+                                                 lVarV0CosPApar[4]);
                 //Only use if tighter than the non-variable cut
                 if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
             }
@@ -3109,17 +3181,17 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             //========================================================================
             //Setting up: Variable BB CosPA
             Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
             if( lCascadeResult->GetCutUseVarBBCosPA() ){
+                Float_t lVarBBCosPApar[5];
+                lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+                lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+                lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+                lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+                lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+                Float_t lVarBBCosPA = TMath::Cos(
+                                                 lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
+                                                 lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
+                                                 lVarBBCosPApar[4]);
                 //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
                 if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
             }
@@ -3128,16 +3200,16 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             //========================================================================
             //Setting up: Variable DCA Casc Dau
             Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
-            Float_t lVarDCACascDaupar[5];
-            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
-            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
-            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
-            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
-            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
-            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
-            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
-            lVarDCACascDaupar[4];
             if( lCascadeResult->GetCutUseVarDCACascDau() ){
+                Float_t lVarDCACascDaupar[5];
+                lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
+                lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
+                lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
+                lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
+                lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
+                Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
+                lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
+                lVarDCACascDaupar[4];
                 //Loosest: default cut, parametric can go tighter
                 if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
             }
@@ -3442,6 +3514,108 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildV0CutIndex()
+{
+    //Index of the V0 configurations on the simple threshold cuts of the
+    //superlight mode. Candidates are checked in full only against the
+    //configurations passing all of these (necessary) conditions.
+    //Order of the cuts has to match the values given in UserExec
+    if( !fV0CutIndex ) fV0CutIndex = new AliWeakResultCutIndex();
+    Int_t lNumberOfConfigurations = fListV0->GetEntries();
+    fV0Configurations.clear();
+    TIter lNext(fListV0);
+    while( AliV0Result *lV0Result = (AliV0Result*) lNext() ) fV0Configurations.push_back(lV0Result);
+    
+    fV0CutIndex->Reset(lNumberOfConfigurations);
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //on-the-fly status, lower edge
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //on-the-fly status, upper edge
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //V0 radius
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //max V0 radius
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA neg to PV
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA pos to PV
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //DCA V0 daughters
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //V0 CosPA (variable cut only tightens)
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //least number of crossed rows
+    fV0CutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //least crossed rows over findable
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = fV0Configurations[lcfg];
+        fV0CutIndex->SetCutValue(0, lcfg, lV0Result->GetUseOnTheFly()-0.5);
+        fV0CutIndex->SetCutValue(1, lcfg, lV0Result->GetUseOnTheFly()+0.5);
+        fV0CutIndex->SetCutValue(2, lcfg, lV0Result->GetCutV0Radius());
+        fV0CutIndex->SetCutValue(3, lcfg, lV0Result->GetCutMaxV0Radius());
+        fV0CutIndex->SetCutValue(4, lcfg, lV0Result->GetCutDCANegToPV());
+        fV0CutIndex->SetCutValue(5, lcfg, lV0Result->GetCutDCAPosToPV());
+        fV0CutIndex->SetCutValue(6, lcfg, lV0Result->GetCutDCAV0Daughters());
+        //the CosPA cut is applied in single precision
+        fV0CutIndex->SetCutValue(7, lcfg, (Float_t) lV0Result->GetCutV0CosPA());
+        fV0CutIndex->SetCutValue(8, lcfg, lV0Result->GetCutLeastNumberOfCrossedRows());
+        fV0CutIndex->SetCutValue(9, lcfg, lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable());
+    }
+    fV0CutIndex->Build();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCascadeCutIndex()
+{
+    //Index of the cascade configurations on the simple threshold cuts of the
+    //superlight mode, all four mass hypotheses in the order of UserExec.
+    //Order of the cuts has to match the values given in UserExec
+    if( !fCascadeCutIndex ) fCascadeCutIndex = new AliWeakResultCutIndex();
+    fCascadeConfigurations.clear();
+    TList *lLists[4] = { fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus };
+    for(Int_t ilist=0; ilist<4; ilist++){
+        TIter lNext(lLists[ilist]);
+        while( AliCascadeResult *lCascadeResult = (AliCascadeResult*) lNext() ) fCascadeConfigurations.push_back(lCascadeResult);
+    }
+    Int_t lNumberOfConfigurations = fCascadeConfigurations.size();
+    
+    fCascadeCutIndex->Reset(lNumberOfConfigurations);
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //charge, lower edge
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //charge, upper edge
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA neg to PV
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA pos to PV
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //DCA V0 daughters
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //V0 CosPA (variable cut only tightens)
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //V0 radius
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA V0 to PV
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA bachelor to PV
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kLessThan);    //DCA cascade daughters (variable cut only tightens)
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //cascade CosPA (variable cut only tightens)
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //cascade radius
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //least number of clusters
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //DCA bachelor to baryon
+    fCascadeCutIndex->AddCut(AliWeakResultCutIndex::kGreaterThan); //min V0 lifetime
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliCascadeResult *lCascadeResult = fCascadeConfigurations[lcfg];
+        //expected charge as in UserExec
+        Int_t lCharge = -2;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    ||
+            lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ) lCharge = -1;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     ||
+            lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ) lCharge = +1;
+        if ( lCharge != -2 && lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        
+        fCascadeCutIndex->SetCutValue( 0, lcfg, lCharge-0.5);
+        fCascadeCutIndex->SetCutValue( 1, lcfg, lCharge+0.5);
+        fCascadeCutIndex->SetCutValue( 2, lcfg, lCascadeResult->GetCutDCANegToPV());
+        fCascadeCutIndex->SetCutValue( 3, lcfg, lCascadeResult->GetCutDCAPosToPV());
+        fCascadeCutIndex->SetCutValue( 4, lcfg, lCascadeResult->GetCutDCAV0Daughters());
+        //the CosPA and DCA cascade daughter cuts are applied in single precision
+        fCascadeCutIndex->SetCutValue( 5, lcfg, (Float_t) lCascadeResult->GetCutV0CosPA());
+        fCascadeCutIndex->SetCutValue( 6, lcfg, lCascadeResult->GetCutV0Radius());
+        fCascadeCutIndex->SetCutValue( 7, lcfg, lCascadeResult->GetCutDCAV0ToPV());
+        fCascadeCutIndex->SetCutValue( 8, lcfg, lCascadeResult->GetCutDCABachToPV());
+        fCascadeCutIndex->SetCutValue( 9, lcfg, (Float_t) lCascadeResult->GetCutDCACascDaughters());
+        fCascadeCutIndex->SetCutValue(10, lcfg, (Float_t) lCascadeResult->GetCutCascCosPA());
+        fCascadeCutIndex->SetCutValue(11, lcfg, lCascadeResult->GetCutCascRadius());
+        fCascadeCutIndex->SetCutValue(12, lcfg, lCascadeResult->GetCutLeastNumberOfClusters());
+        fCascadeCutIndex->SetCutValue(13, lcfg, lCascadeResult->GetCutDCABachToBaryon());
+        fCascadeCutIndex->SetCutValue(14, lcfg, lCascadeResult->GetCutMinV0Lifetime());
+    }
+    fCascadeCutIndex->Build();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
@@ -44,10 +44,12 @@ class AliPIDResponse;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliWeakResultCutIndex;
 class AliExternalTrackParam;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 #include "AliEventCuts.h"
 
@@ -96,6 +98,10 @@ public:
     void SetExtraCleanup ( Bool_t lExtraCleanup = kTRUE) {
         fkExtraCleanup = lExtraCleanup;
     }
+    void SetUseConfigurationIndex ( Bool_t lUseConfigurationIndex = kTRUE) {
+        //Check candidates only against configurations passing the indexed threshold cuts
+        fkUseConfigurationIndex = lUseConfigurationIndex;
+    }
 //---------------------------------------------------------------------------------------
     void SetUseExtraEvSels ( Bool_t lUseExtraEvSels = kTRUE) {
         fkDoExtraEvSels = lUseExtraEvSels;
@@ -215,6 +221,10 @@ public:
     Float_t GetDCAz(AliESDtrack *lTrack);
     Float_t GetCosPA(AliESDtrack *lPosTrack, AliESDtrack *lNegTrack, AliESDEvent *lEvent);
 //---------------------------------------------------------------------------------------
+    //Superlight mode: threshold index of the configurations
+    void BuildV0CutIndex();
+    void BuildCascadeCutIndex();
+//---------------------------------------------------------------------------------------
 
 
 private:
@@ -283,6 +293,9 @@ private:
     //if true, save sandbox mode info (beware large files!)
     Bool_t fkSandboxMode; 
     
+    //if true, check candidates only against configurations passing the indexed threshold cuts
+    Bool_t fkUseConfigurationIndex;
+    
 //===========================================================================================
 //   Variables for Event Tree
 //===========================================================================================
@@ -625,11 +638,22 @@ private:
     TH1D *fHistEventCounterDifferential; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Superlight mode: threshold index of the configurations
+//===========================================================================================
+
+    AliWeakResultCutIndex *fV0CutIndex;      //! index of the V0 configurations
+    AliWeakResultCutIndex *fCascadeCutIndex; //! index of the cascade configurations
+    std::vector<AliV0Result*> fV0Configurations;           //! V0 configurations, as indexed
+    std::vector<AliCascadeResult*> fCascadeConfigurations; //! cascade configurations, as indexed
+    std::vector<Int_t> fSelectedConfigurations;            //! configurations passing the indexed cuts
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 3);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
     //1: first implementation
+    //4: threshold index of the superlight configurations
 };
 
 #endif
@@ -41,6 +41,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <Riostream.h>
+#include <vector>
 #include "TList.h"
 #include "TH1.h"
 #include "TH2.h"
@@ -144,6 +145,8 @@ fkDoXYPlanePreOptCascade( kFALSE ),
 fkDoPureGeometricMinimization( kFALSE ),
 fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
+fkUseHelixPreFilter( kFALSE ),
+fHelixPreFilterMargin( 1.0 ),
 fMinPtV0(   -1 ), //pre-selection
 fMaxPtV0( 1000 ),
 fMinPtCascade(   0.3 ),
@@ -194,6 +197,8 @@ fkDoXYPlanePreOptCascade( kFALSE ),
 fkDoPureGeometricMinimization( kFALSE ),
 fkDoCascadeRefit( kFALSE ) ,
 fMaxIterationsWhenMinimizing(27),
+fkUseHelixPreFilter( kFALSE ),
+fHelixPreFilterMargin( 1.0 ),
 fMinPtV0(   -1 ), //pre-selection
 fMaxPtV0( 1000 ),
 fMinPtCascade(   0.3 ), //pre-selection
@@ -565,6 +570,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
     TArrayI neg(nentr);
     TArrayI pos(nentr);
     
+    //Per-track quantities of the pair loop, evaluated once per track:
+    //DCAxy to PV, mass for tracking, starting parameters and helix circle
+    std::vector<Double_t> lNegD, lPosD, lNegMass, lPosMass;
+    std::vector<AliExternalTrackParam> lNegParams, lPosParams;
+    std::vector<Double_t> lNegCircle, lPosCircle;
+    
     Long_t nneg=0, npos=0, nvtx=0;
     
     Long_t i;
@@ -584,21 +595,45 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fV0VertexerSels[2]) continue;
         if (TMath::Abs(d)>fV0VertexerSels[6]) continue;
         
-        if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
-        else pos[npos++]=i;
+        //Starting parameters, re-propagated to closest position to the primary vertex if asked to do so
+        AliExternalTrackParam lParam(*esdTrack);
+        if (fkResetInitialPositions){
+            Double_t dztemp[2], covartemp[3];
+            //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
+            lParam.PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
+        }
+        
+        //select maximum eta range: the dip angle does not change when propagating,
+        //so that this is the same as the selection after propagation in the pair loop
+        if (TMath::Abs(lParam.Eta())>0.8&&fkExtraCleanup) continue;
+        
+        Double_t lCircle[3];
+        GetHelixCircle(&lParam, b, lCircle);
+        
+        if (esdTrack->GetSign() < 0.){
+            neg[nneg++]=i;
+            lNegD.push_back(TMath::Abs(d));
+            lNegMass.push_back(esdTrack->GetMassForTracking());
+            lNegParams.push_back(lParam);
+            lNegCircle.insert(lNegCircle.end(), lCircle, lCircle+3);
+        }else{
+            pos[npos++]=i;
+            lPosD.push_back(TMath::Abs(d));
+            lPosMass.push_back(esdTrack->GetMassForTracking());
+            lPosParams.push_back(lParam);
+            lPosCircle.insert(lPosCircle.end(), lCircle, lCircle+3);
+        }
     }
     
     
     for (i=0; i<nneg; i++) {
         Long_t nidx=neg[i];
-        AliESDtrack *ntrk=event->GetTrack(nidx);
         
         for (Int_t k=0; k<npos; k++) {
             Int_t pidx=pos[k];
-            AliESDtrack *ptrk=event->GetTrack(pidx);
             
-            Double_t lNegMassForTracking = ntrk->GetMassForTracking();
-            Double_t lPosMassForTracking = ptrk->GetMassForTracking();
+            Double_t lNegMassForTracking = lNegMass[i];
+            Double_t lPosMassForTracking = lPosMass[k];
             
             //Pre-select dE/dx: only proceed if at least one of these tracks looks like a proton
             /*
@@ -609,22 +644,19 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
              }
              */
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[1])
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fV0VertexerSels[2]) continue;
+            if (lNegD[i]<fV0VertexerSels[1])
+                if (lPosD[k]<fV0VertexerSels[2]) continue;
+            
+            //Optional pre-filter: transverse distance of the helix circles
+            if (fkUseHelixPreFilter &&
+                GetCircleDistanceXY(&lNegCircle[3*i], &lPosCircle[3*k]) > fV0VertexerSels[3]+fHelixPreFilterMargin) continue;
             
-            AliExternalTrackParam nt(*ntrk), pt(*ptrk), *ntp=&nt, *ptp=&pt;
+            //Starting parameters (already re-propagated to the primary vertex if requested)
+            AliExternalTrackParam nt(lNegParams[i]), pt(lPosParams[k]), *ntp=&nt, *ptp=&pt;
             Double_t xn, xp, dca;
             
             //Improved call: use own function, including XY-pre-opt stage
             
-            //Re-propagate to closest position to the primary vertex if asked to do so
-            if (fkResetInitialPositions){
-                Double_t dztemp[2], covartemp[3];
-                //Safety margin: 250 -> exceedingly large... not sure this makes sense, but ok
-                ntp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-                ptp->PropagateToDCA( vtxT3D , b , 250, dztemp, covartemp );
-            }
-            
             if( fkDoImprovedDCAV0DauPropagation ){
                 //Improved: use own call
                 dca=GetDCAV0Dau(ptp, ntp, xp, xn, b, lNegMassForTracking, lPosMassForTracking);
@@ -646,9 +678,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
                 AliTrackerBase::PropagateTrackTo(ptp, xp, lPosMassForTracking, 3, kFALSE, 0.75, kFALSE, kTRUE );
             }
             
-            //select maximum eta range (after propagation)
-            if (TMath::Abs(nt.Eta())>0.8&&fkExtraCleanup) continue;
-            if (TMath::Abs(pt.Eta())>0.8&&fkExtraCleanup) continue;
+            //select maximum eta range (after propagation): already applied to the tracks
             
             AliESDv0 vertex(nt,nidx,pt,pidx);
             
@@ -797,7 +827,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     
     // stores relevant tracks in another array
     Long_t nentr=(Int_t)event->GetNumberOfTracks();
-    TArrayI trk(nentr); Long_t ntr=0;
+    //bachelor candidates per charge, in track order, with their helix circle
+    std::vector<Int_t> lBachMinus, lBachPlus;
+    std::vector<Double_t> lBachCircle(3*nentr, -1.);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         ULong_t status=esdtr->GetStatus();
@@ -811,7 +843,9 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         if (esdtr->GetTPCNcls() < 70 && lThisTrackLength<80 ) continue;
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
-        trk[ntr++]=i;
+        if (esdtr->GetSign()<=0) lBachMinus.push_back(i);
+        if (esdtr->GetSign()>=0) lBachPlus.push_back(i);
+        if (fkUseHelixPreFilter) GetHelixCircle(esdtr, b, &lBachCircle[3*i]);
     }
     
     Double_t massLambda=1.11568;
@@ -823,16 +857,18 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        for (UInt_t j=0; j<lBachMinus.size(); j++) {//loop on tracks with the bachelor's charge
+            Int_t bidx=lBachMinus[j];
             //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
             
+            //Optional pre-filter: transverse distance of V0 line and bachelor circle
+            if (fkUseHelixPreFilter &&
+                GetV0CircleDistanceXY(&v0, &lBachCircle[3*bidx]) > fCascadeVertexerSels[4]+fHelixPreFilterMargin) continue;
+            
             AliESDtrack *btrk=event->GetTrack(bidx);
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
-            if (btrk->GetSign()>0) continue;  // bachelor's charge
-            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -897,15 +933,17 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
         
-        for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+        for (UInt_t j=0; j<lBachPlus.size(); j++) {//loop on tracks with the bachelor's charge
+            Int_t bidx=lBachPlus[j];
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
             
+            //Optional pre-filter: transverse distance of V0 line and bachelor circle
+            if (fkUseHelixPreFilter &&
+                GetV0CircleDistanceXY(&v0, &lBachCircle[3*bidx]) > fCascadeVertexerSels[4]+fHelixPreFilterMargin) continue;
+            
             AliESDtrack *btrk=event->GetTrack(bidx);
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
-            if (btrk->GetSign()<0) continue;  // bachelor's charge
-            
             AliESDv0 *pv0=&v0;
             AliExternalTrackParam bt(*btrk), *pbt=&bt;
             
@@ -1089,6 +1127,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
     // stores candidate bachelor tracks in another array
     Int_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Int_t ntr=0;
+    std::vector<Double_t> lBachCircle(3*nentr, -1.);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         
@@ -1105,6 +1144,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
         
         trk[ntr++]=i;
+        if (fkUseHelixPreFilter) GetHelixCircle(esdtr, b, &lBachCircle[3*i]);
     }
     
     Double_t massLambda=1.11568;
@@ -1137,6 +1177,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
             if (v0.GetIndex(0)==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
             
+            //Optional pre-filter: transverse distance of V0 line and bachelor circle
+            if (fkUseHelixPreFilter &&
+                GetV0CircleDistanceXY(&v0, &lBachCircle[3*bidx]) > fCascadeVertexerSels[4]+fHelixPreFilterMargin) continue;
+            
             AliESDtrack *btrk=event->GetTrack(bidx);
             Float_t lBachMassForTracking=btrk->GetMassForTracking();
             
@@ -1997,3 +2041,46 @@ void AliAnalysisTaskWeakDecayVertexer::GetHelixCenter(const AliExternalTrackPara
     center[1] =	ypos + ypoint;
     return;
 }
+
+///________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetHelixCircle(const AliExternalTrackParam *track, Double_t b, Double_t circle[3]){
+    // Transverse projection of the helix: center (circle[0], circle[1]) and
+    // radius circle[2], radius negative for a straight track
+    Double_t helix[6];
+    track->GetHelixParameters(helix,b);
+    circle[0] = circle[1] = 0.;
+    circle[2] = -1.;
+    if( TMath::Abs(helix[4]) < 1e-33 ) return;
+    GetHelixCenter( track, circle, b );
+    circle[2] = TMath::Abs(1./helix[4]);
+}
+
+///________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetCircleDistanceXY(const Double_t *circle1, const Double_t *circle2) const {
+    // Smallest distance between points of two circles in the transverse plane,
+    // zero if it cannot be determined (straight tracks)
+    if( circle1[2] < 0 || circle2[2] < 0 ) return 0.;
+    Double_t lDist = TMath::Sqrt( (circle1[0]-circle2[0])*(circle1[0]-circle2[0]) +
+                                 (circle1[1]-circle2[1])*(circle1[1]-circle2[1]) );
+    //Case 1: centers far away
+    if( lDist > circle1[2] + circle2[2] ) return lDist - circle1[2] - circle2[2];
+    //Case 3: one inside the other
+    if( lDist < TMath::Abs(circle1[2] - circle2[2]) ) return TMath::Abs(circle1[2] - circle2[2]) - lDist;
+    //Case 2: circles touch
+    return 0.;
+}
+
+///________________________________________________________________________
+Double_t AliAnalysisTaskWeakDecayVertexer::GetV0CircleDistanceXY(const AliESDv0 *v0, const Double_t *circle) const {
+    // Smallest distance between the V0 line and a circle in the transverse plane,
+    // zero if it cannot be determined
+    if( circle[2] < 0 ) return 0.;
+    Double_t x, y, z, px, py, pz;
+    v0->GetXYZ(x,y,z);
+    v0->GetPxPyPz(px,py,pz);
+    Double_t lPt = TMath::Sqrt(px*px+py*py);
+    if( lPt < 1e-33 ) return 0.;
+    Double_t lDist = TMath::Abs( (circle[0]-x)*py - (circle[1]-y)*px ) / lPt;
+    if( lDist > circle[2] ) return lDist - circle[2];
+    return 0.;
+}
@@ -100,6 +100,13 @@ public:
     void SetMaxIterations (Long_t lMaxIter = 100){
         fMaxIterationsWhenMinimizing = lMaxIter;
     }
+    void SetUseHelixPreFilter( Bool_t lOpt = kTRUE, Double_t lMargin = 1.0 ){
+        //Skip pairs whose helix circles are further apart in the transverse plane
+        //than the DCA daughters selection plus lMargin (cm), before the DCA minimization.
+        //Approximate: the DCA daughters is uncertainty-weighted. Use with care!
+        fkUseHelixPreFilter = lOpt;
+        fHelixPreFilterMargin = lMargin;
+    }
     
     
 //---------------------------------------------------------------------------------------
@@ -225,6 +232,10 @@ public:
     //Improved DCA V0 Dau
     Double_t GetDCAV0Dau ( AliExternalTrackParam *pt, AliExternalTrackParam *nt, Double_t &xp, Double_t &xn, Double_t b, Double_t lNegMassForTracking=0.139, Double_t lPosMassForTracking=0.139);
     void GetHelixCenter(const AliExternalTrackParam *track,Double_t center[2], Double_t b);
+    //Transverse helix geometry for the pair pre-filter
+    void GetHelixCircle(const AliExternalTrackParam *track, Double_t b, Double_t circle[3]);
+    Double_t GetCircleDistanceXY(const Double_t *circle1, const Double_t *circle2) const;
+    Double_t GetV0CircleDistanceXY(const AliESDv0 *v0, const Double_t *circle) const;
     //---------------------------------------------------------------------------------------
 
 private:
@@ -268,6 +279,8 @@ private:
     Bool_t fkDoPureGeometricMinimization;
     Bool_t fkDoCascadeRefit; //WARNING: needs DoV0Refit!
     Long_t fMaxIterationsWhenMinimizing;
+    Bool_t fkUseHelixPreFilter; //if true, skip pairs with helix circles far apart in XY (approximate)
+    Double_t fHelixPreFilterMargin; //margin (cm) added to the DCA daughters selection in the pre-filter
     
     //Min/Max pT for cascades
     Float_t fMinPtV0; //minimum pt above which we keep candidates in TTree output
@@ -295,8 +308,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: helix pre-filter switch
 };
 
 #endif
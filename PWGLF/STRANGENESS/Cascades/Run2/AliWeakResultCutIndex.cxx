@@ -0,0 +1,127 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Threshold index of the configurations of the superlight mode
+// See header for details
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include <algorithm>
+#include <TMath.h>
+#include "AliWeakResultCutIndex.h"
+#include "AliLog.h"
+
+ClassImp(AliWeakResultCutIndex);
+
+//________________________________________________________________
+AliWeakResultCutIndex::AliWeakResultCutIndex() :
+TObject(),
+fNConfigurations(0),
+fCutType(),
+fValues(),
+fSorted(),
+fOrder(),
+fAlwaysFail(),
+fPass()
+{
+    // Empty index, use Reset
+}
+
+//________________________________________________________________
+AliWeakResultCutIndex::~AliWeakResultCutIndex(){
+    // Nothing owned
+}
+
+//________________________________________________________________
+void AliWeakResultCutIndex::Reset(Int_t lNConfigurations){
+    // Remove all cuts and set the number of configurations
+    fNConfigurations = lNConfigurations;
+    fCutType.clear();
+    fValues.clear();
+    fSorted.clear();
+    fOrder.clear();
+    fAlwaysFail.assign((lNConfigurations+63)/64, 0);
+    fPass.assign((lNConfigurations+63)/64, 0);
+}
+
+//________________________________________________________________
+Int_t AliWeakResultCutIndex::AddCut(ECutType lType){
+    // Add a variable to the index, values of all configurations to be set
+    fCutType.push_back(lType);
+    fValues.push_back(std::vector<Double_t>(fNConfigurations, 0.));
+    return fCutType.size()-1;
+}
+
+//________________________________________________________________
+void AliWeakResultCutIndex::SetCutValue(Int_t lCut, Int_t lConfiguration, Double_t lValue){
+    fValues[lCut][lConfiguration] = lValue;
+}
+
+//________________________________________________________________
+void AliWeakResultCutIndex::Build(){
+    // Sort the cut values of each variable. A comparison with an undefined
+    // cut is always false: such configurations never pass
+    Int_t lNCuts = fCutType.size();
+    fSorted.assign(lNCuts, std::vector<Double_t>());
+    fOrder.assign(lNCuts, std::vector<Int_t>());
+    fAlwaysFail.assign((fNConfigurations+63)/64, 0);
+    
+    std::vector< std::pair<Double_t,Int_t> > lPairs;
+    for(Int_t icut=0; icut<lNCuts; icut++){
+        lPairs.clear();
+        for(Int_t icfg=0; icfg<fNConfigurations; icfg++){
+            Double_t lValue = fValues[icut][icfg];
+            if( TMath::IsNaN(lValue) ){
+                fAlwaysFail[icfg/64] |= (1ULL << (icfg%64));
+                continue;
+            }
+            lPairs.push_back(std::make_pair(lValue, icfg));
+        }
+        std::sort(lPairs.begin(), lPairs.end());
+        for(UInt_t ip=0; ip<lPairs.size(); ip++){
+            fSorted[icut].push_back(lPairs[ip].first);
+            fOrder[icut].push_back(lPairs[ip].second);
+        }
+    }
+}
+
+//________________________________________________________________
+void AliWeakResultCutIndex::ClearRange(Int_t lFirst, Int_t lLast, const std::vector<Int_t> &lOrder){
+    // Remove the configurations lOrder[lFirst..lLast[ from the bitset
+    for(Int_t ip=lFirst; ip<lLast; ip++){
+        Int_t icfg = lOrder[ip];
+        fPass[icfg/64] &= ~(1ULL << (icfg%64));
+    }
+}
+
+//________________________________________________________________
+void AliWeakResultCutIndex::Select(const Double_t *lValues, std::vector<Int_t> &lSelected){
+    // Configurations that pass all indexed cuts, in increasing order
+    lSelected.clear();
+    Int_t lNWords = fPass.size();
+    for(Int_t iw=0; iw<lNWords; iw++) fPass[iw] = ~fAlwaysFail[iw];
+    
+    Int_t lNCuts = fCutType.size();
+    for(Int_t icut=0; icut<lNCuts; icut++){
+        const std::vector<Double_t> &lSorted = fSorted[icut];
+        Double_t lValue = lValues[icut];
+        if( fCutType[icut] == kGreaterThan ){
+            //fails if cut >= value (all if value is NaN)
+            Int_t lFirst = std::lower_bound(lSorted.begin(), lSorted.end(), lValue) - lSorted.begin();
+            ClearRange(lFirst, lSorted.size(), fOrder[icut]);
+        }else{
+            //fails if cut <= value (all if value is NaN)
+            Int_t lLast = std::upper_bound(lSorted.begin(), lSorted.end(), lValue) - lSorted.begin();
+            ClearRange(0, lLast, fOrder[icut]);
+        }
+    }
+    
+    for(Int_t iw=0; iw<lNWords; iw++){
+        ULong64_t lWord = fPass[iw];
+        while( lWord ){
+            Int_t lBit = 0;
+            while( !(lWord & (1ULL << lBit)) ) lBit++;
+            Int_t icfg = iw*64+lBit;
+            if( icfg >= fNConfigurations ) break;
+            lSelected.push_back(icfg);
+            lWord &= ~(1ULL << lBit);
+        }
+    }
+}
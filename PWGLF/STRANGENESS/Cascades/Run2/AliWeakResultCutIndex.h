@@ -0,0 +1,56 @@
+#ifndef AliWeakResultCutIndex_H
+#define AliWeakResultCutIndex_H
+#include <TObject.h>
+#include <vector>
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Threshold index of the configurations of the superlight mode
+//
+// For each indexed variable the cut values of all configurations
+// (AliV0Result or AliCascadeResult) are kept sorted, so that the
+// configurations a candidate fails are found with a binary search
+// and removed from a bitset of configurations. Only necessary
+// conditions are indexed: the configurations left still have to be
+// checked with the full selection, they are returned in their
+// original order.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliWeakResultCutIndex : public TObject {
+    
+public:
+    //Type of cut: candidate passes if value > cut or value < cut
+    enum ECutType { kGreaterThan = 0, kLessThan };
+    
+    AliWeakResultCutIndex();
+    ~AliWeakResultCutIndex();
+    
+    //Setup: number of configurations, then cuts, then values
+    void  Reset(Int_t lNConfigurations);
+    Int_t AddCut(ECutType lType);
+    void  SetCutValue(Int_t lCut, Int_t lConfiguration, Double_t lValue);
+    void  Build();
+    
+    Int_t GetNConfigurations() const { return fNConfigurations; }
+    Int_t GetNCuts() const { return fCutType.size(); }
+    
+    //Configurations passing all indexed cuts for the candidate values (one per cut)
+    void Select(const Double_t *lValues, std::vector<Int_t> &lSelected);
+    
+private:
+    AliWeakResultCutIndex(const AliWeakResultCutIndex&);            // not implemented
+    AliWeakResultCutIndex& operator=(const AliWeakResultCutIndex&); // not implemented
+    
+    void ClearRange(Int_t lFirst, Int_t lLast, const std::vector<Int_t> &lOrder);
+    
+    Int_t fNConfigurations;                          //number of configurations
+    std::vector<Int_t> fCutType;                     //ECutType of each cut
+    std::vector< std::vector<Double_t> > fValues;    //cut values, per cut and configuration
+    std::vector< std::vector<Double_t> > fSorted;    //cut values sorted, per cut
+    std::vector< std::vector<Int_t> > fOrder;        //configuration of each sorted value, per cut
+    std::vector<ULong64_t> fAlwaysFail;              //configurations with undefined (NaN) cut values
+    std::vector<ULong64_t> fPass;                    //bitset of configurations, per candidate
+    
+    ClassDef(AliWeakResultCutIndex, 1)
+    // 1 - original implementation
+};
+#endif
@@ -47,6 +47,14 @@
   trigger.LoadTriggerList("gidesdTrigger.list");
   trigger.ExtractSelected("raw.list", "gidesdTrigger.list", "rawSelected[].root",1000000, 1  );
   //
+  // 5b.) Same using the GID index of the period: built once per period from the dumped raw GID list,
+  //      raw chunks without triggered events are not opened at all 
+  //
+  AliOfflineTrigger::MakeGIDIndex("gidrawTree.list","gidIndex.root");
+  AliOfflineTrigger trigger("default", 30,100000000);
+  trigger.LoadGIDIndex("gidIndex.root");
+  trigger.ExtractSelected("raw.list", "gidesdTrigger.list", "rawSelected[].root",1000000, 1  );
+  //
   // 6.) Example to compare content of the raw filtered data with input flitered list as used in the filterning produnction
   TTree * tree = AliOfflineTrigger::MakeDiffTree("gidrawTree.list","filteredHighPt.list;filteredHighPtV0s.list;filteredMult.list");
   Int_t entriesAll=tree->GetEntries();
@@ -80,10 +88,12 @@
 #include "AliOfflineTrigger.h"
 #include "AliSysInfo.h"
 #include "TTimeStamp.h"
+#include "TObjString.h"
 #ifdef WITHALIEN
 #include "TAlienCollection.h"
 #endif
 #include "TPRegexp.h"
+#include <algorithm>
 using std::cout;
 using std::endl;
 
@@ -107,7 +117,13 @@ AliOfflineTrigger::AliOfflineTrigger(const char *triggerName, Int_t timeOut, Int
   fRAWGIDTimeStamp(),
   fDefaultTimeOut(timeOut),
   fDefaultTreeCache(cacheSize),
-  fESDTriggerList(NULL)
+  fESDTriggerList(NULL),
+  fIndexGID(),
+  fIndexChunk(),
+  fIndexEntry(),
+  fIndexChunkNames(NULL),
+  fIndexTriggered(),
+  fIndexComplete(kFALSE)
 {
   // set timeouts
   gSystem->Setenv("XRDCLIENTMAXWAIT",Form("%d",timeOut));
@@ -660,7 +676,24 @@ void   AliOfflineTrigger::ExtractSelected(const char *rawList, const char * trig
     ::Error("AliOfflineTrigger::ExtractSelected","Empty input list");
   }
   LoadTriggerList(triggerList);
+  fIndexComplete=kFALSE;
+  if (fIndexGID.size()>0){       // batched lookup of the triggered GIDs in the GID index
+    std::vector<ULong64_t> gids;
+    gids.reserve(fTrgGIDTimeStamp.size());
+    for (std::map<ULong64_t, UInt_t>::const_iterator it=fTrgGIDTimeStamp.begin(); it!=fTrgGIDTimeStamp.end(); ++it) gids.push_back(it->first);
+    Int_t nFound=LookupGIDIndex(gids.size(), gids.size()>0 ? &(gids[0]):NULL, fIndexTriggered);
+    ::Info("AliOfflineTrigger::ExtractSelected","GID index: %d/%d triggered events found in %d chunks", nFound, Int_t(gids.size()), Int_t(fIndexTriggered.size()));
+    // index not covering the trigger list (other runs/passes, incomplete raw GID list) - a chunk without indexed events may still contain triggered ones 
+    fIndexComplete=(nFound==Int_t(gids.size()));
+    if (!fIndexComplete){
+      ::Warning("AliOfflineTrigger::ExtractSelected","GID index incomplete: %d triggered events not found - chunk skipping disabled, all %d files scanned", Int_t(gids.size())-nFound, nFiles);
+    }
+  }
   for (Int_t iFile=0; iFile<nFiles; iFile++){
+    if (fIndexComplete && !IsChunkTriggered(rawArray->At(iFile)->GetName())){
+      if ((verbose&1)>0) ::Info("AliOfflineTrigger::ExtractSelected","No triggered event in %s - skipped", rawArray->At(iFile)->GetName());
+      continue;
+    }
     if (fRawTriggerTree!=NULL){
       if (fRawTriggerTree->GetZipBytes()>maxSize){ // close file if content bigger than max Size
 	fRawTriggerFile->cd();
@@ -692,3 +725,186 @@ void   AliOfflineTrigger::ExtractSelected(const char *rawList, const char * trig
     fCounterFileOutput++;
   }
 }
+
+
+namespace {
+  /// \brief Helper to sort GID index records
+  struct GIDIndexRecord {
+    ULong64_t fGID;    ///< global event ID
+    Int_t     fChunk;  ///< chunk ID
+    UInt_t    fEntry;  ///< entry in chunk
+    bool operator<(const GIDIndexRecord &other) const { 
+      return fGID<other.fGID || (fGID==other.fGID && (fChunk<other.fChunk || (fChunk==other.fChunk && fEntry<other.fEntry)));
+    }
+  };
+}
+
+Int_t AliOfflineTrigger::MakeGIDIndex(const char *gidRawList, const char *indexName){
+  //
+  // Build persistent GID index GID -> (raw chunk, entry) out of the csv raw GID list (see DumpGIDRAWTree)
+  // To be built once per period
+  // Input:
+  //    gidRawList  - csv file with the raw GID list (fname/C:eventCounter/i:gid/l:...)
+  //    indexName   - name of output root file
+  // Output:
+  //    root file with tree "gidIndex" (gid/l:chunk/I:entry/i) sorted in GID 
+  //    and array "chunkNames" (chunk ID -> chunk name; in order of appearance in the raw GID list)
+  // Return:
+  //    number of entries in index
+  /*
+    AliOfflineTrigger::MakeGIDIndex("gidrawTree.list","gidIndex.root");
+  */
+  TTree * tree= new TTree();
+  tree->ReadFile(gidRawList,"",'\t');
+  Int_t entries=tree->GetEntries();
+  TBranch *chBranch=tree->GetBranch("fname");
+  TBranch *gidBranch=tree->GetBranch("gid");
+  TBranch *counterBranch=tree->GetBranch("eventCounter");
+  if (entries<=0 || chBranch==NULL || gidBranch==NULL || counterBranch==NULL){
+    ::Error("AliOfflineTrigger::MakeGIDIndex","Invalid input GID list\t%s", gidRawList);
+    delete tree;
+    return 0;
+  }
+  ULong64_t gid;
+  UInt_t eventCounter;
+  char * chbuffer= new char[10000];
+  chBranch->SetAddress(chbuffer);
+  gidBranch->SetAddress(&gid);
+  counterBranch->SetAddress(&eventCounter);
+  //
+  TObjArray chunkNames;
+  chunkNames.SetOwner(kTRUE);
+  std::map<TString, Int_t> chunkIDs;
+  std::vector<GIDIndexRecord> records;
+  records.reserve(entries);
+  for (Int_t i=0; i<entries; i++){
+    tree->GetEntry(i);
+    TString chunkName=chbuffer;
+    std::map<TString, Int_t>::const_iterator it=chunkIDs.find(chunkName);
+    Int_t chunkID=(it!=chunkIDs.end()) ? it->second:chunkNames.GetEntriesFast();
+    if (it==chunkIDs.end()){
+      chunkIDs[chunkName]=chunkID;
+      chunkNames.AddLast(new TObjString(chunkName));
+    }
+    GIDIndexRecord record={gid, chunkID, eventCounter};
+    records.push_back(record);
+  }
+  delete tree;
+  delete [] chbuffer;
+  std::sort(records.begin(),records.end());
+  //
+  TFile *foutput=TFile::Open(indexName,"recreate");
+  if (foutput==NULL){
+    ::Error("AliOfflineTrigger::MakeGIDIndex","Output file %s can not be created", indexName);
+    return 0;
+  }
+  TTree *index=new TTree("gidIndex","GID -> (chunk, entry) sorted in GID");
+  GIDIndexRecord record;
+  index->Branch("gid",&record.fGID,"gid/l");
+  index->Branch("chunk",&record.fChunk,"chunk/I");
+  index->Branch("entry",&record.fEntry,"entry/i");
+  for (UInt_t i=0; i<records.size(); i++){
+    if (i>0 && records[i].fGID==records[i-1].fGID){
+      ::Error("AliOfflineTrigger::MakeGIDIndex","GID %llu not unique: %s:%u and %s:%u",records[i].fGID,
+	      chunkNames.At(records[i-1].fChunk)->GetName(), records[i-1].fEntry, chunkNames.At(records[i].fChunk)->GetName(), records[i].fEntry);
+    }
+    record=records[i];
+    index->Fill();
+  }
+  index->Write();
+  chunkNames.Write("chunkNames",TObject::kSingleKey);
+  Int_t nEntries=index->GetEntries();
+  delete foutput;
+  ::Info("AliOfflineTrigger::MakeGIDIndex","%s: %d events in %d chunks",indexName,nEntries,chunkNames.GetEntriesFast());
+  return nEntries;
+}
+
+Int_t AliOfflineTrigger::LoadGIDIndex(const char *indexName){
+  //
+  // Load GID index made by MakeGIDIndex into memory
+  // Return:
+  //    number of entries in index 
+  if (TPRegexp("^alien").Match(indexName) && gGrid==0)  TGrid::Connect("alien");
+  TFile *finput=TFile::Open(indexName);
+  if (finput==NULL){
+    ::Error("AliOfflineTrigger::LoadGIDIndex","Index file %s not accessible",indexName);
+    return 0;
+  }
+  TTree *index=(TTree*)finput->Get("gidIndex");
+  TObjArray *chunkNames=(TObjArray*)finput->Get("chunkNames");
+  if (chunkNames) chunkNames->SetOwner(kTRUE);
+  if (index==NULL || chunkNames==NULL){
+    ::Error("AliOfflineTrigger::LoadGIDIndex","Index file %s does not contain GID index",indexName);
+    delete chunkNames;
+    delete finput;
+    return 0;
+  }
+  ULong64_t gid;
+  Int_t chunk;
+  UInt_t entry;
+  index->SetBranchAddress("gid",&gid);
+  index->SetBranchAddress("chunk",&chunk);
+  index->SetBranchAddress("entry",&entry);
+  Int_t entries=index->GetEntries();
+  fIndexGID.resize(entries);
+  fIndexChunk.resize(entries);
+  fIndexEntry.resize(entries);
+  for (Int_t i=0; i<entries; i++){
+    index->GetEntry(i);
+    fIndexGID[i]=gid;
+    fIndexChunk[i]=chunk;
+    fIndexEntry[i]=entry;
+  }
+  delete fIndexChunkNames;
+  fIndexChunkNames=chunkNames;
+  delete index;
+  delete finput;
+  return entries;
+}
+
+Int_t AliOfflineTrigger::LookupGIDIndex(Int_t nGID, const ULong64_t *gids, std::map<Int_t, std::vector<UInt_t> > &chunkEntries) const {
+  //
+  // Batched lookup of GIDs in the GID index
+  // Input:
+  //    nGID, gids   - GIDs to look up 
+  // Output: 
+  //    chunkEntries - chunk ID -> sorted entries in chunk. Chunk IDs follow the file order of the raw GID list
+  // Return:
+  //    number of GIDs found
+  //
+  // Queries are sorted and merged with the sorted index - O((N+M) log M) instead of one scan per query 
+  chunkEntries.clear();
+  if (nGID<=0 || fIndexGID.size()==0) return 0;
+  std::vector<ULong64_t> query(gids, gids+nGID);
+  std::sort(query.begin(), query.end());
+  Int_t nFound=0;
+  std::vector<ULong64_t>::const_iterator first=fIndexGID.begin();
+  for (UInt_t i=0; i<query.size(); i++){
+    if (i>0 && query[i]==query[i-1]) continue;
+    first=std::lower_bound(first, fIndexGID.end(), query[i]);
+    if (first==fIndexGID.end()) break;
+    if (*first!=query[i]) continue;
+    Int_t pos=first-fIndexGID.begin();
+    chunkEntries[fIndexChunk[pos]].push_back(fIndexEntry[pos]);
+    nFound++;
+  }
+  for (std::map<Int_t, std::vector<UInt_t> >::iterator it=chunkEntries.begin(); it!=chunkEntries.end(); ++it){
+    std::sort(it->second.begin(), it->second.end());
+  }
+  return nFound;
+}
+
+Bool_t AliOfflineTrigger::IsChunkTriggered(const char *rawFile) const {
+  //
+  // Check if raw file contains triggered events according to the GID index lookup done in ExtractSelected
+  // Chunk names in the index are the short names (see DumpGIDRAWTree) - rawFile has to end with it
+  // If not all triggered GIDs were found in the index, every chunk is considered triggered
+  //
+  if (fIndexChunkNames==NULL || !fIndexComplete) return kTRUE;
+  TString fileName(rawFile);
+  for (std::map<Int_t, std::vector<UInt_t> >::const_iterator it=fIndexTriggered.begin(); it!=fIndexTriggered.end(); ++it){
+    if (it->first<0 || it->first>=fIndexChunkNames->GetEntriesFast()) continue;
+    if (fileName.EndsWith(fIndexChunkNames->At(it->first)->GetName())) return kTRUE;
+  }
+  return kFALSE;
+}
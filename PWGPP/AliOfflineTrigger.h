@@ -11,11 +11,13 @@
 /// \author Marian Ivanov   - marian.ivanov@cern.ch
 /// \author Mesut Arslandok, Mikolaj  - older versions (rawmerege.C)
 
+#include <map>
+#include <vector>
 
 class AliOfflineTrigger : public TNamed {
 public:
   AliOfflineTrigger(const char *triggerName, Int_t timeOut=30, Int_t cacheSize=500000000);
-  virtual ~AliOfflineTrigger(){;}
+  virtual ~AliOfflineTrigger(){delete fIndexChunkNames;}
   void     DumpGIDRAWReader(const char *rawFile="raw.root");
   void     DumpGIDRAWTree(const char *rawFile="raw.root");
   void     DumpGIDESD(const char * chinput="AliESDs.root", const char *trigger="1", const char *choutput="gidesd.list");
@@ -29,6 +31,11 @@ public:
   void  LoadTriggerList(const char * triggerList);
   Int_t LoadMapFromRawData(const char *rawFile="raw.root", Int_t verbose=1);
   void  ExtractSelected(const char *rawFile="raw.root", Int_t verbose=1);
+  //  Persistent sorted GID index   GID -> (raw chunk, entry)
+  static Int_t MakeGIDIndex(const char *gidRawList="gidrawTree.list", const char *indexName="gidIndex.root");
+  Int_t  LoadGIDIndex(const char *indexName="gidIndex.root");
+  Int_t  LookupGIDIndex(Int_t nGID, const ULong64_t *gids, std::map<Int_t, std::vector<UInt_t> > &chunkEntries) const;
+  Bool_t IsChunkTriggered(const char *rawFile) const;
 public:
   //private: 
   std::map<ULong64_t, TString>  fTrgGIDChunkName;  /// GID -> ChunkName 
@@ -51,7 +58,16 @@ public:
   Int_t   fDefaultTimeOut;         // default time out in seconds for reading and file opening
   Int_t   fDefaultTreeCache;       // default tree cache size
   TObjArray *fESDTriggerList;      // esd trigger list (set of aliases)
-  ClassDef(AliOfflineTrigger, 1);  // interface to various trending trees
+  std::vector<ULong64_t>  fIndexGID;       ///! GID index - sorted GIDs
+  std::vector<Int_t>      fIndexChunk;     ///! GID index - chunk ID for sorted GIDs
+  std::vector<UInt_t>     fIndexEntry;     ///! GID index - entry in chunk for sorted GIDs
+  TObjArray *fIndexChunkNames;             ///! GID index - chunk ID -> chunk name 
+  std::map<Int_t, std::vector<UInt_t> > fIndexTriggered; ///! chunk ID -> triggered entries (from trigger list)
+  Bool_t     fIndexComplete;               ///! all triggered GIDs found in the GID index - chunks without triggered events can be skipped
+private:
+  AliOfflineTrigger(const AliOfflineTrigger&);            // not implemented
+  AliOfflineTrigger& operator=(const AliOfflineTrigger&); // not implemented
+  ClassDef(AliOfflineTrigger, 2);  // interface to various trending trees
 };
 
 #endif // ALIOFFLINETRIGGER_H
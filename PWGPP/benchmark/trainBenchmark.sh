@@ -0,0 +1,108 @@
+#!/usr/bin/env bash
+
+# Local benchmark of a reference analysis train.
+# Runs trainBenchmark.C on a local list of ESD or AOD files, once single-process and
+# once split into N parallel processes, and writes a machine readable summary
+# (key=value per line) with events/s, peak RSS and the time spent per task.
+# Compare summaries between tags to track throughput regressions.
+#
+# usage:
+#   trainBenchmark.sh inputList [nProcesses] [nEvents] [wagons] [outputDir]
+# e.g.:
+#   trainBenchmark.sh AOD.list 4 2000 PhysSel,Jet,PhiCorr benchmark_$(date +%Y%m%d)
+#
+# output:
+#   outputDir/single/...             - logs and summary of the single process run
+#   outputDir/multi/job*/...         - logs and summaries of the N process run
+#   outputDir/trainBenchmark.summary - combined summary
+
+main()
+{
+  if [[ $# -lt 1 ]]; then
+    echo "usage: ${0} inputList [nProcesses=4] [nEvents=-1] [wagons] [outputDir=trainBenchmark]"
+    return 1
+  fi
+  inputList=$(readlink -f ${1})
+  nProcesses=${2:-4}
+  nEvents=${3:--1}
+  wagons=${4:-"PhysSel,MultSel,Tender,EmcalCorr,Jet,PhiCorr,VertexingHF"}
+  outputDir=${5:-trainBenchmark}
+  macro=${ALICE_PHYSICS}/PWGPP/benchmark/trainBenchmark.C
+  [[ -f ./trainBenchmark.C ]] && macro=$(readlink -f ./trainBenchmark.C)
+  timeCommand=$(which time 2>/dev/null)
+  [[ -z ${timeCommand} ]] && timeCommand=/usr/bin/time
+
+  [[ ! -f ${inputList} ]] && echo "input list ${inputList} not found" && return 1
+  mkdir -p ${outputDir}
+  outputDir=$(readlink -f ${outputDir})
+  summary=${outputDir}/trainBenchmark.summary
+
+  # single process
+  runJob ${outputDir}/single ${inputList} ${nEvents}
+
+  # N processes, input split round robin, events split evenly
+  mkdir -p ${outputDir}/multi
+  rm -f ${outputDir}/multi/input_*.list
+  awk -v n=${nProcesses} -v dir=${outputDir}/multi \
+    'NF>0 {print > (dir"/input_"((NR-1)%n)".list")}' ${inputList}
+  nEventsJob=-1
+  [[ ${nEvents} -ge 0 ]] && nEventsJob=$(( (nEvents+nProcesses-1)/nProcesses ))
+  multiStart=$(date +%s.%N)
+  for ((i=0; i<nProcesses; i++)); do
+    [[ -f ${outputDir}/multi/input_${i}.list ]] || continue
+    runJob ${outputDir}/multi/job${i} ${outputDir}/multi/input_${i}.list ${nEventsJob} &
+  done
+  wait
+  multiStop=$(date +%s.%N)
+
+  # combined summary
+  {
+    echo "version=${ALIPHYSICS_VERSION:-unknown}"
+    echo "host=$(hostname)"
+    echo "date=$(date +%Y-%m-%dT%H:%M:%S)"
+    echo "wagons=${wagons}"
+    sed -e 's/^/single./' ${outputDir}/single/trainBenchmark.summary 2>/dev/null
+    echo "single.peakRSSkB=$(peakRSS ${outputDir}/single/time.log)"
+    echo "multi.processes=${nProcesses}"
+    cat ${outputDir}/multi/job*/trainBenchmark.summary 2>/dev/null | awk -F= \
+      -v wall=$(echo "${multiStop} ${multiStart}" | awk '{print $1-$2}') '
+      $1=="events" {events+=$2}
+      $1 ~ /^taskTime\./ {task[$1]+=$2}
+      END {
+        print "multi.events=" events
+        print "multi.realTime=" wall
+        print "multi.eventsPerSecond=" ((wall>0) ? events/wall : 0)
+        for (t in task) print "multi." t "=" task[t]
+      }'
+    maxRSS=0
+    for log in ${outputDir}/multi/job*/time.log; do
+      rss=$(peakRSS ${log})
+      [[ ${rss} -gt ${maxRSS} ]] && maxRSS=${rss}
+    done
+    echo "multi.peakRSSkB=${maxRSS}"
+  } > ${summary}
+  cat ${summary}
+  return 0
+}
+
+runJob()
+(
+  # run trainBenchmark.C in directory $1 on list $2 for $3 events
+  jobDir=${1}
+  jobList=${2}
+  jobEvents=${3}
+  mkdir -p ${jobDir}
+  cd ${jobDir}
+  ${timeCommand} -v -o time.log \
+    aliroot -l -b -q "${macro}(\"${jobList}\",${jobEvents},\"${wagons}\",\"trainBenchmark.summary\")" \
+    &> trainBenchmark.log
+)
+
+peakRSS()
+{
+  # peak resident memory in kB from the output of /usr/bin/time -v
+  local rss=$(awk -F: '/Maximum resident set size/ {gsub(/ /,"",$2); print $2}' ${1} 2>/dev/null)
+  echo ${rss:-0}
+}
+
+main "$@"